@@ -1,15 +1,19 @@
 /**
  * @file colors.h
- * @brief Color definitions and threshold functions for the InspectAir project
+ * @brief Color definitions and thresholds for the InspectAir project
  * @author Team InspectAir
  * @date January 2026
  * 
- * Defines RGB565 colors and classification functions for:
+ * Defines RGB565 colors and the thresholds for:
  * - CO2 levels (WHO guidelines)
  * - PM2.5 particulate matter (WHO 2021)
+ * - PM10 particulate matter (EEA European AQI)
  * - VOC index
  * - Temperature (comfort zone)
  * - Humidity (comfort zone)
+ *
+ * Classification happens in src/utils/aqi_engine.h (breakpoint tables
+ * built from these limits).
  */
 
 #ifndef COLORS_H
@@ -60,6 +64,14 @@
 #define LIMIT_PM25_BAD      25   /**< WHO 2021: ≤25 µg/m³ = poor */
 /** @} */
 
+/** @name PM10 thresholds (µg/m³, EEA European AQI)
+ *  @{
+ */
+#define LIMIT_PM10_GOOD     20   /**< EEA: ≤20 µg/m³ = good */
+#define LIMIT_PM10_MODERATE 40   /**< EEA: ≤40 µg/m³ = fair */
+#define LIMIT_PM10_BAD      50   /**< EEA: ≤50 µg/m³ = moderate */
+/** @} */
+
 /** @name VOC index thresholds
  *  @{
  */
@@ -86,66 +98,4 @@
 #define LIMIT_HUM_WARN_MAX  70   /**< Upper limit acceptable */
 /** @} */
 
-// ============================================
-// COLOR CLASSIFICATION - SENSORS
-// ============================================
-
-/**
- * @brief Determines color based on CO2 level
- * @param co2 CO2 concentration in ppm
- * @return RGB565 color (COLOR_GOOD/MODERATE/BAD/DANGER)
- */
-inline uint16_t getCO2Color(int co2) {
-  if (co2 < LIMIT_CO2_GOOD)     return COLOR_GOOD;
-  if (co2 < LIMIT_CO2_MODERATE) return COLOR_MODERATE;
-  if (co2 < LIMIT_CO2_BAD)      return COLOR_BAD;
-  return COLOR_DANGER;
-}
-
-/**
- * @brief Determines color based on PM2.5 level (WHO 2021)
- * @param pm25 Particulate matter in µg/m³
- * @return RGB565 color (COLOR_GOOD/MODERATE/BAD/DANGER)
- */
-inline uint16_t getPM25Color(int pm25) {
-  if (pm25 <= LIMIT_PM25_GOOD)     return COLOR_GOOD;
-  if (pm25 <= LIMIT_PM25_MODERATE) return COLOR_MODERATE;
-  if (pm25 <= LIMIT_PM25_BAD)      return COLOR_BAD;
-  return COLOR_DANGER;
-}
-
-/**
- * @brief Determines color based on VOC index
- * @param voc VOC index (0-500)
- * @return RGB565 color (COLOR_GOOD/MODERATE/BAD/DANGER)
- */
-inline uint16_t getVOCColor(int voc) {
-  if (voc <= LIMIT_VOC_GOOD)     return COLOR_GOOD;
-  if (voc <= LIMIT_VOC_MODERATE) return COLOR_MODERATE;
-  if (voc <= LIMIT_VOC_BAD)      return COLOR_BAD;
-  return COLOR_DANGER;
-}
-
-/**
- * @brief Determines color based on temperature
- * @param temp Temperature in °C
- * @return RGB565 color (COLOR_GOOD/MODERATE/BAD)
- */
-inline uint16_t getTempColor(float temp) {
-  if (temp >= LIMIT_TEMP_GOOD_MIN && temp <= LIMIT_TEMP_GOOD_MAX) return COLOR_GOOD;
-  if (temp >= LIMIT_TEMP_WARN_MIN && temp <= LIMIT_TEMP_WARN_MAX) return COLOR_MODERATE;
-  return COLOR_BAD;
-}
-
-/**
- * @brief Determines color based on humidity
- * @param hum Relative humidity in %
- * @return RGB565 color (COLOR_GOOD/MODERATE/BAD)
- */
-inline uint16_t getHumColor(float hum) {
-  if (hum >= LIMIT_HUM_GOOD_MIN && hum <= LIMIT_HUM_GOOD_MAX) return COLOR_GOOD;
-  if (hum >= LIMIT_HUM_WARN_MIN && hum <= LIMIT_HUM_WARN_MAX) return COLOR_MODERATE;
-  return COLOR_BAD;
-}
-
 #endif
@@ -0,0 +1,106 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - DISPLAY POWER POLICY (LD2410C presence)
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "display_power.h"
+#include "lvgl_driver.h"
+#include "ui_manager.h"
+
+// Global instance
+DisplayPower displayPower;
+
+static const char* const STATE_NAMES[DISPLAY_STATE_COUNT] = { "active", "dimmed", "blanked" };
+
+void DisplayPower::begin() {
+    state = DISPLAY_ACTIVE;
+    lastPresence = millis();
+    stateSince = lastPresence;
+    lvgl_set_backlight(POWER_LEVEL_FULL);
+}
+
+void DisplayPower::enter(DisplayPowerState next) {
+    unsigned long now = millis();
+    stateMs[state] += now - stateSince;
+    stateSince = now;
+    
+    switch (next) {
+        case DISPLAY_ACTIVE:
+            // Resume rendering and queue the UI wake; the backlight is set
+            // right away, so the panel shows the content from before the
+            // blank until the render task draws the next frame (one
+            // render cycle later)
+            if (state == DISPLAY_BLANKED) {
+                lvgl_set_suspended(false);
+                ui_setPowerSave(false);
+            }
+            lvgl_set_backlight(POWER_LEVEL_FULL);
+            wakeups++;
+            break;
+        case DISPLAY_DIMMED:
+            lvgl_set_backlight(POWER_LEVEL_DIM);
+            break;
+        case DISPLAY_BLANKED:
+            lvgl_set_backlight(0);
+            ui_setPowerSave(true);
+            lvgl_set_suspended(true);
+            break;
+        default:
+            break;
+    }
+    
+    Serial.printf("[POWER] Display %s -> %s (idle %lu s)\n", STATE_NAMES[state], STATE_NAMES[next],
+                  (unsigned long)((now - lastPresence) / 1000));
+    state = next;
+}
+
+void DisplayPower::update(const LD2410C_Data& radar, unsigned long lastRadarOk) {
+    unsigned long now = millis();
+    
+    // Any target (moving or stationary) counts; stale radar data too
+    bool radarStale = (now - lastRadarOk) > POWER_RADAR_STALE_MS;
+    bool present = radarStale || radar.presence || radar.motion || radar.distance > 0;
+    
+    if (present) {
+        lastPresence = now;
+        if (state != DISPLAY_ACTIVE) {
+            enter(DISPLAY_ACTIVE);
+        }
+        return;
+    }
+    
+    unsigned long idle = now - lastPresence;
+    if (idle >= POWER_BLANK_AFTER_MS) {
+        if (state != DISPLAY_BLANKED) enter(DISPLAY_BLANKED);
+    } else if (idle >= POWER_DIM_AFTER_MS) {
+        if (state == DISPLAY_ACTIVE) enter(DISPLAY_DIMMED);
+    }
+}
+
+bool DisplayPower::wake() {
+    bool wasBlanked = (state == DISPLAY_BLANKED);
+    lastPresence = millis();
+    if (state != DISPLAY_ACTIVE) {
+        enter(DISPLAY_ACTIVE);
+    }
+    return wasBlanked;
+}
+
+void DisplayPower::printStatus() {
+    unsigned long now = millis();
+    uint32_t ms[DISPLAY_STATE_COUNT];
+    uint32_t total = 0;
+    for (int i = 0; i < DISPLAY_STATE_COUNT; i++) {
+        ms[i] = stateMs[i] + ((i == state) ? now - stateSince : 0);
+        total += ms[i];
+    }
+    if (total == 0) total = 1;
+    
+    Serial.printf("[POWER] Display %s, idle %lu s | active %lu%% dimmed %lu%% blanked %lu%%, %lu wakeups\n",
+                  STATE_NAMES[state], (unsigned long)((now - lastPresence) / 1000),
+                  (unsigned long)((uint64_t)ms[DISPLAY_ACTIVE] * 100 / total),
+                  (unsigned long)((uint64_t)ms[DISPLAY_DIMMED] * 100 / total),
+                  (unsigned long)((uint64_t)ms[DISPLAY_BLANKED] * 100 / total),
+                  (unsigned long)wakeups);
+}
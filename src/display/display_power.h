@@ -0,0 +1,91 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - DISPLAY POWER POLICY (LD2410C presence)
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Nobody in front of the device → no reason to light or render the screen:
+ *
+ *   ACTIVE  ── no presence for POWER_DIM_AFTER_MS ──→  DIMMED  (backlight low)
+ *   DIMMED  ── no presence for POWER_BLANK_AFTER_MS ─→ BLANKED (backlight off,
+ *                                                      LVGL suspended, leaves stopped)
+ *   any     ── radar presence/motion or button ─────→ ACTIVE  (at once)
+ *
+ * The backlight and the render task are the main heat sources next to the
+ * AHT20, so this also reduces the self-heating bias of the temperature.
+ * Without fresh radar data the room counts as occupied (never blank blind).
+ */
+
+#ifndef DISPLAY_POWER_H
+#define DISPLAY_POWER_H
+
+#include <Arduino.h>
+#include "sensor_types.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define POWER_DIM_AFTER_MS      (2UL * 60 * 1000)   // No presence → dim
+#define POWER_BLANK_AFTER_MS    (10UL * 60 * 1000)  // No presence → blank
+#define POWER_LEVEL_FULL        255     // Backlight PWM while active
+#define POWER_LEVEL_DIM         40      // Backlight PWM while dimmed (~15%)
+#define POWER_RADAR_STALE_MS    10000   // Older radar data = presence unknown
+
+// ═══════════════════════════════════════════════════════════════════════════
+// STATES
+// ═══════════════════════════════════════════════════════════════════════════
+
+enum DisplayPowerState : uint8_t {
+    DISPLAY_ACTIVE = 0,
+    DISPLAY_DIMMED,
+    DISPLAY_BLANKED,
+    DISPLAY_STATE_COUNT
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DISPLAY POWER CLASS
+// ═══════════════════════════════════════════════════════════════════════════
+
+class DisplayPower {
+private:
+    DisplayPowerState state = DISPLAY_ACTIVE;
+    unsigned long lastPresence = 0;
+    unsigned long stateSince = 0;
+    
+    // Time per state since begin() (ms, current state not yet included)
+    uint32_t stateMs[DISPLAY_STATE_COUNT] = {};
+    uint32_t wakeups = 0;
+    
+    void enter(DisplayPowerState next);
+
+public:
+    /**
+     * Starts in ACTIVE with full backlight (call after lvgl_init())
+     */
+    void begin();
+    
+    /**
+     * Evaluates the policy, call on every loop pass
+     * @param radar Latest radar reading
+     * @param lastRadarOk millis() of the last successful radar read
+     */
+    void update(const LD2410C_Data& radar, unsigned long lastRadarOk);
+    
+    /**
+     * User input (button): back to ACTIVE
+     * @return true if the display was blanked (the input only woke it)
+     */
+    bool wake();
+    
+    DisplayPowerState getState() const { return state; }
+    
+    /**
+     * Debug output (state, idle time, share of time per state)
+     */
+    void printStatus();
+};
+
+// Global instance
+extern DisplayPower displayPower;
+
+#endif // DISPLAY_POWER_H
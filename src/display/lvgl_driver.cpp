@@ -6,31 +6,427 @@
 #include "lvgl_driver.h"
 #include "pins.h"
 #include <Arduino.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
 
 // Global display object
 static LGFX tft;
 
-// LVGL Tick
-static uint32_t last_tick = 0;
+// Render task
+static TaskHandle_t lvgl_task = nullptr;
+static SemaphoreHandle_t lvgl_mutex = nullptr;
+static void (*frame_hook)(void) = nullptr;
+
+// Display blanked: no timers, no rendering, only queued UI updates
+static volatile bool suspended = false;
+
+// Frame governor: invalidated areas not rendered yet, render task load
+static volatile bool inv_pending = false;
+static uint32_t load_start_ms = 0;
+static uint32_t load_wakeups = 0;
+static uint64_t load_busy_us = 0;
 
 // LVGL display and buffer
 static lv_display_t* display = nullptr;
 static uint8_t* buf1 = nullptr;
 static uint8_t* buf2 = nullptr;
+static uint16_t band_lines = 0;         // Lines per draw buffer
+static bool buf_in_psram = false;
+
+// Band heights tried for internal DMA buffers (largest first)
+static const uint16_t BAND_HEIGHTS[] = { 64, 48, 40, 32, 24, 16 };
+static const int BAND_HEIGHT_COUNT = sizeof(BAND_HEIGHTS) / sizeof(BAND_HEIGHTS[0]);
+
+// Direct mode: full framebuffer, dirty areas of the current frame
+#define LVGL_FB_SIZE  ((size_t)SCREEN_WIDTH * SCREEN_HEIGHT * 2)
+static uint16_t* framebuffer = nullptr;
+static bool direct_mode = false;
+static lv_area_t dirty[LVGL_DIRTY_MAX];
+static int dirty_count = 0;
+static uint32_t stat_dirty_areas = 0;
+
+// Async flush: SPI bus is held from the first band until the frame is done
+static bool flush_async = true;
+static bool bus_claimed = false;
+
+// Flush statistics
+static uint32_t frame_start_us = 0;
+static uint32_t stat_frames = 0;
+static uint32_t stat_bands = 0;
+static uint32_t stat_last_frame_us = 0;
+static uint64_t stat_total_frame_us = 0;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FRAME PROFILER
+// ═══════════════════════════════════════════════════════════════════════════
+// Per frame: render time (lv_timer_handler minus time blocked on SPI),
+// flush time (CPU blocked on SPI incl. the final DMA wait) and flushed area;
+// per second: FPS. Each goes into a fixed-size histogram.
+
+struct ProfHistogram {
+    const char* name;
+    const uint32_t* edges;          // Upper bounds of the first buckets
+    uint32_t counts[LVGL_PROF_BUCKETS];
+    uint32_t n;
+    uint32_t max;
+    uint64_t sum;
+};
+
+static const uint32_t PROF_TIME_EDGES_US[LVGL_PROF_BUCKETS - 1] = { 1000, 2000, 4000, 8000, 16000, 33000, 66000 };
+static const uint32_t PROF_AREA_EDGES_PCT[LVGL_PROF_BUCKETS - 1] = { 1, 2, 5, 10, 25, 50, 100 };
+static const uint32_t PROF_FPS_EDGES[LVGL_PROF_BUCKETS - 1] = { 1, 5, 10, 15, 20, 25, 30 };
+
+static ProfHistogram prof_render = { "render_us", PROF_TIME_EDGES_US };
+static ProfHistogram prof_flush  = { "flush_us",  PROF_TIME_EDGES_US };
+static ProfHistogram prof_area   = { "area_pct",  PROF_AREA_EDGES_PCT };
+static ProfHistogram prof_fps    = { "fps",       PROF_FPS_EDGES };
+
+// Current frame (reset before every lv_timer_handler())
+static uint32_t frame_px = 0;               // Pixels flushed
+static uint32_t frame_block_us = 0;         // Blocked in flush_cb / flush_wait_cb
+static uint32_t frame_tail_us = 0;          // Final DMA wait after the handler
+
+// Totals since reset and the current one-second window
+static uint32_t prof_start_ms = 0;
+static uint64_t prof_total_px = 0;
+static uint32_t win_start_ms = 0;
+static uint32_t win_frames = 0;
+static uint32_t win_render_us = 0;
+static uint32_t win_flush_us = 0;
+static uint32_t win_px = 0;
+
+// Overlay (label on the top layer, refreshed once per second)
+static lv_obj_t* prof_label = nullptr;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DIRECT MODE: DIRTY AREA COALESCING
+// ═══════════════════════════════════════════════════════════════════════════
+
+static uint32_t area_px(const lv_area_t* a) {
+    return (uint32_t)(a->x2 - a->x1 + 1) * (a->y2 - a->y1 + 1);
+}
+
+static void area_bounds(lv_area_t* out, const lv_area_t* a, const lv_area_t* b) {
+    out->x1 = LV_MIN(a->x1, b->x1);
+    out->y1 = LV_MIN(a->y1, b->y1);
+    out->x2 = LV_MAX(a->x2, b->x2);
+    out->y2 = LV_MAX(a->y2, b->y2);
+}
+
+/**
+ * Merges two dirty areas when their bounding box costs at most as many
+ * pixels as both areas plus the setup cost of one extra window
+ * (LVGL_WINDOW_COST_PX). Overlapping areas are judged by the same rule.
+ */
+static void coalesce_dirty(void) {
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < dirty_count && !merged; i++) {
+            for (int j = i + 1; j < dirty_count; j++) {
+                lv_area_t box;
+                area_bounds(&box, &dirty[i], &dirty[j]);
+                if (area_px(&box) > area_px(&dirty[i]) + area_px(&dirty[j]) + LVGL_WINDOW_COST_PX) continue;
+                
+                dirty[i] = box;
+                dirty[j] = dirty[--dirty_count];
+                merged = true;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Direct mode: LVGL has drawn the area into the framebuffer. Areas are
+ * collected until the last one of the frame, then sent as few windows
+ * (row by row out of the framebuffer, blocking: PSRAM is not DMA-able here)
+ */
+static void direct_flush(lv_display_t* disp, const lv_area_t* area) {
+    stat_dirty_areas++;
+    if (dirty_count < LVGL_DIRTY_MAX) {
+        dirty[dirty_count++] = *area;
+    } else {
+        area_bounds(&dirty[LVGL_DIRTY_MAX - 1], &dirty[LVGL_DIRTY_MAX - 1], area);
+    }
+    
+    if (lv_display_flush_is_last(disp)) {
+        coalesce_dirty();
+        for (int i = 0; i < dirty_count; i++) {
+            const lv_area_t* a = &dirty[i];
+            int32_t w = a->x2 - a->x1 + 1;
+            tft.setAddrWindow(a->x1, a->y1, w, a->y2 - a->y1 + 1);
+            for (int32_t y = a->y1; y <= a->y2; y++) {
+                tft.writePixels(&framebuffer[y * SCREEN_WIDTH + a->x1], w);
+            }
+            frame_px += area_px(a);
+            stat_bands++;
+        }
+        dirty_count = 0;
+    }
+    lv_display_flush_ready(disp);
+}
 
 /**
  * Display flush callback for LVGL 9
+ * Partial mode: starts the DMA transfer and returns immediately, so LVGL
+ * renders the next band into the other buffer while this one is on the wire.
  */
 static void lvgl_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    uint32_t t0 = micros();
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
     
-    tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.writePixels((uint16_t*)px_map, w * h);
-    tft.endWrite();
+    if (!bus_claimed) {
+        tft.startWrite();
+        bus_claimed = true;
+        frame_start_us = micros();
+    }
     
+    if (direct_mode) {
+        direct_flush(disp, area);
+        frame_block_us += micros() - t0;
+        return;
+    }
+    stat_bands++;
+    
+    if (flush_async) {
+        // DMA sends the buffer as-is: swap to panel byte order first
+        lv_draw_sw_rgb565_swap(px_map, w * h);
+        tft.setAddrWindow(area->x1, area->y1, w, h);
+        tft.writePixelsDMA((uint16_t*)px_map, w * h, false);
+        // flush_ready is signalled by lvgl_flush_wait_cb()
+    } else {
+        tft.setAddrWindow(area->x1, area->y1, w, h);
+        tft.writePixels((uint16_t*)px_map, w * h);
+        lv_display_flush_ready(disp);
+    }
+    
+    frame_px += w * h;
+    frame_block_us += micros() - t0;
+}
+
+/**
+ * Called by LVGL before it reuses a buffer that was handed to flush_cb
+ */
+static void lvgl_flush_wait_cb(lv_display_t* disp) {
+    uint32_t t0 = micros();
+    tft.waitDMA();
     lv_display_flush_ready(disp);
+    frame_block_us += micros() - t0;
+}
+
+/**
+ * Waits for the last transfer of a frame and releases the SPI bus
+ */
+void lvgl_finish_frame(void) {
+    if (!bus_claimed) return;
+    
+    uint32_t t0 = micros();
+    tft.waitDMA();
+    lv_display_flush_ready(display);
+    tft.endWrite();
+    bus_claimed = false;
+    frame_tail_us += micros() - t0;
+    
+    stat_last_frame_us = micros() - frame_start_us;
+    stat_total_frame_us += stat_last_frame_us;
+    stat_frames++;
+}
+
+static void prof_add(ProfHistogram* h, uint32_t value) {
+    int b = 0;
+    while (b < LVGL_PROF_BUCKETS - 1 && value >= h->edges[b]) b++;
+    h->counts[b]++;
+    h->n++;
+    h->sum += value;
+    if (value > h->max) h->max = value;
+}
+
+static void prof_clear(ProfHistogram* h) {
+    memset(h->counts, 0, sizeof(h->counts));
+    h->n = 0;
+    h->max = 0;
+    h->sum = 0;
+}
+
+// Shows the averages of the window that just ended
+static void prof_update_overlay(uint32_t fps) {
+    if (!prof_label) return;
+    
+    uint32_t frames = win_frames ? win_frames : 1;
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%lu fps  R %lu.%lu  F %lu.%lu ms  %lu%%",
+             (unsigned long)fps,
+             (unsigned long)(win_render_us / frames / 1000), (unsigned long)(win_render_us / frames / 100 % 10),
+             (unsigned long)(win_flush_us / frames / 1000), (unsigned long)(win_flush_us / frames / 100 % 10),
+             (unsigned long)((uint64_t)win_px * 100 / frames / (SCREEN_WIDTH * SCREEN_HEIGHT)));
+    lv_label_set_text(prof_label, buf);
+}
+
+/**
+ * Books the frame rendered by the last lv_timer_handler() call
+ * @param handler_us Duration of lv_timer_handler()
+ */
+static void prof_record_frame(uint32_t handler_us) {
+    uint32_t now = millis();
+    
+    if (frame_px > 0) {
+        uint32_t render_us = (handler_us > frame_block_us) ? handler_us - frame_block_us : 0;
+        uint32_t flush_us = frame_block_us + frame_tail_us;
+        uint32_t area_pct = (uint32_t)((uint64_t)frame_px * 100 / (SCREEN_WIDTH * SCREEN_HEIGHT));
+        
+        prof_add(&prof_render, render_us);
+        prof_add(&prof_flush, flush_us);
+        prof_add(&prof_area, area_pct);
+        prof_total_px += frame_px;
+        
+        win_frames++;
+        win_render_us += render_us;
+        win_flush_us += flush_us;
+        win_px += frame_px;
+    }
+    
+    // One FPS sample per second (idle seconds count as 0 fps)
+    if (now - win_start_ms >= 1000) {
+        uint32_t fps = win_frames * 1000 / (now - win_start_ms);
+        prof_add(&prof_fps, fps);
+        prof_update_overlay(fps);
+        win_start_ms = now;
+        win_frames = 0;
+        win_render_us = 0;
+        win_flush_us = 0;
+        win_px = 0;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DRAW BUFFER MANAGEMENT
+// ═══════════════════════════════════════════════════════════════════════════
+
+static void free_buffers(void) {
+    heap_caps_free(buf1);
+    heap_caps_free(buf2);
+    buf1 = nullptr;
+    buf2 = nullptr;
+    band_lines = 0;
+}
+
+/**
+ * Allocates both draw buffers with the given height
+ * @param internal true = internal DMA-capable SRAM, false = PSRAM/heap
+ */
+static bool alloc_buffers(uint16_t lines, bool internal) {
+    free_buffers();
+    
+    size_t size = (size_t)SCREEN_WIDTH * lines * 2;
+    uint32_t caps = internal ? (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL) : MALLOC_CAP_SPIRAM;
+    buf1 = (uint8_t*)heap_caps_malloc(size, caps);
+    buf2 = (uint8_t*)heap_caps_malloc(size, caps);
+    if (!internal) {
+        if (!buf1) buf1 = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        if (!buf2) buf2 = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+    if (!buf1 || !buf2) {
+        free_buffers();
+        return false;
+    }
+    
+    band_lines = lines;
+    buf_in_psram = !internal;
+    return true;
+}
+
+/**
+ * Returns true if two internal buffers of this height fit without
+ * eating into LVGL_INTERNAL_RESERVE
+ */
+static bool internal_fits(uint16_t lines) {
+    size_t size = (size_t)SCREEN_WIDTH * lines * 2;
+    size_t free_dma = heap_caps_get_free_size(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    return largest >= size && free_dma >= 2 * size + LVGL_INTERNAL_RESERVE;
+}
+
+/**
+ * Picks the largest band that fits into internal DMA RAM,
+ * PSRAM only when no internal band fits
+ */
+static bool select_buffers(void) {
+    for (int i = 0; i < BAND_HEIGHT_COUNT; i++) {
+        if (internal_fits(BAND_HEIGHTS[i]) && alloc_buffers(BAND_HEIGHTS[i], true)) {
+            return true;
+        }
+    }
+    return alloc_buffers(LVGL_BUF_SIZE / SCREEN_WIDTH, false);
+}
+
+static bool alloc_framebuffer(void) {
+    if (framebuffer) return true;
+    framebuffer = (uint16_t*)heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, LVGL_FB_SIZE,
+                                                     MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return framebuffer != nullptr;
+}
+
+static void free_framebuffer(void) {
+    heap_caps_free(framebuffer);
+    framebuffer = nullptr;
+}
+
+/**
+ * Switches between partial bands and the direct framebuffer (allocates
+ * what is missing) and redraws the whole screen
+ */
+static bool use_render_mode(bool direct) {
+    if (direct) {
+        if (!alloc_framebuffer()) return false;
+        lv_display_set_buffers(display, framebuffer, nullptr, LVGL_FB_SIZE,
+                               LV_DISPLAY_RENDER_MODE_DIRECT);
+        flush_async = false;
+    } else {
+        if (!buf1 && !select_buffers()) return false;
+        lv_display_set_buffers(display, buf1, buf2, (size_t)SCREEN_WIDTH * band_lines * 2,
+                               LV_DISPLAY_RENDER_MODE_PARTIAL);
+        // DMA from PSRAM needs bounce copies: flush blocking there
+        flush_async = !buf_in_psram;
+    }
+    direct_mode = direct;
+    dirty_count = 0;
+    
+    // A fresh framebuffer holds nothing yet
+    if (lv_screen_active()) lv_obj_invalidate(lv_screen_active());
+    return true;
+}
+
+/**
+ * Back to the mode selected at init, freeing benchmark-only buffers
+ */
+static void restore_render_mode(bool direct) {
+    if (!use_render_mode(direct)) use_render_mode(!direct);
+    if (direct_mode) free_buffers();
+    else free_framebuffer();
+}
+
+/**
+ * LVGL tick source: read from esp_timer on demand instead of a periodic
+ * interrupt, so an idle UI does not wake the CPU every few ms
+ */
+static uint32_t lvgl_tick_cb(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+/**
+ * Display events: track whether areas are invalidated but not yet rendered
+ */
+static void lvgl_invalidate_cb(lv_event_t* e) {
+    inv_pending = true;
+}
+
+static void lvgl_refr_ready_cb(lv_event_t* e) {
+    inv_pending = false;
 }
 
 /**
@@ -45,52 +441,400 @@ void lvgl_init(void) {
     tft.init();
     tft.setRotation(1);  // Landscape Mode
     tft.fillScreen(TFT_BLACK);
+    tft.setBrightness(LVGL_BACKLIGHT_FULL);  // Light_PWM owns the pin now
     
     // Initialize LVGL
     lv_init();
+    lvgl_mutex = xSemaphoreCreateRecursiveMutex();
     
-    // Buffer size in bytes (16-bit = 2 bytes per pixel)
-    size_t buf_size = LVGL_BUF_SIZE * 2;
+    // Tick from esp_timer's 64-bit clock (not from loop timing)
+    lv_tick_set_cb(lvgl_tick_cb);
+    prof_start_ms = millis();
+    win_start_ms = prof_start_ms;
+    load_start_ms = prof_start_ms;
     
-    // Use PSRAM for buffer
-    #ifdef BOARD_HAS_PSRAM
-        buf1 = (uint8_t*)heap_caps_malloc(buf_size, MALLOC_CAP_SPIRAM);
-        buf2 = (uint8_t*)heap_caps_malloc(buf_size, MALLOC_CAP_SPIRAM);
-        if (!buf1) buf1 = (uint8_t*)malloc(buf_size);
-        if (!buf2) buf2 = (uint8_t*)malloc(buf_size);
-    #else
-        buf1 = (uint8_t*)malloc(buf_size);
-        buf2 = (uint8_t*)malloc(buf_size);
-    #endif
+    // Create display (LVGL 9 API)
+    display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
+    lv_display_set_flush_cb(display, lvgl_flush_cb);
+    lv_display_set_flush_wait_cb(display, lvgl_flush_wait_cb);
+    lv_display_add_event_cb(display, lvgl_invalidate_cb, LV_EVENT_INVALIDATE_AREA, nullptr);
+    lv_display_add_event_cb(display, lvgl_refr_ready_cb, LV_EVENT_REFR_READY, nullptr);
     
-    if (!buf1 || !buf2) {
+    // Draw buffers: direct framebuffer if selected, else bands in internal
+    // DMA RAM with PSRAM as fallback
+    if (!use_render_mode(LVGL_RENDER_DIRECT) && !use_render_mode(!LVGL_RENDER_DIRECT)) {
         Serial.println("[LVGL] ERROR: Buffer allocation failed!");
         return;
     }
     
-    // Create display (LVGL 9 API)
-    display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
-    lv_display_set_flush_cb(display, lvgl_flush_cb);
-    lv_display_set_buffers(display, buf1, buf2, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
-    
     Serial.println("[LVGL 9] Display initialized");
     Serial.printf("[LVGL 9] Resolution: %dx%d\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (direct_mode) {
+        Serial.printf("[LVGL 9] Direct mode: %d KB framebuffer in PSRAM, coalesced windows\n",
+                      (int)(LVGL_FB_SIZE / 1024));
+    } else {
+        Serial.printf("[LVGL 9] Draw buffers: 2 x %d lines (%d KB each) in %s, %s flush\n",
+                      band_lines, (int)(SCREEN_WIDTH * band_lines * 2 / 1024),
+                      buf_in_psram ? "PSRAM" : "internal DMA RAM",
+                      flush_async ? "async DMA" : "blocking");
+    }
+}
+
+/**
+ * Runs one LVGL cycle (UI messages, timers, rendering)
+ * @return Time until LVGL needs to run again (ms)
+ */
+static uint32_t lvgl_run_once(void) {
+    lvgl_lock();
+    if (frame_hook) frame_hook();
+    frame_px = 0;
+    frame_block_us = 0;
+    frame_tail_us = 0;
+    uint32_t t0 = micros();
+    uint32_t next = lv_timer_handler();
+    uint32_t handler_us = micros() - t0;
+    lvgl_finish_frame();
+    prof_record_frame(handler_us);
+    lvgl_unlock();
+    load_busy_us += micros() - t0;
+    load_wakeups++;
+    return next;
+}
+
+/**
+ * Frame governor: how long the render task may sleep
+ * @param next Return value of lv_timer_handler() (LV_NO_TIMER_READY if no
+ *             timer is active; the refresh and animation timers pause
+ *             themselves while nothing is invalidated or animated)
+ */
+static uint32_t lvgl_sleep_ms(uint32_t next) {
+#if LVGL_GOVERNOR
+    if (next > LVGL_TASK_MAX_IDLE_MS) next = LVGL_TASK_MAX_IDLE_MS;
+    // Invalidated after the refresh ran: render within one refresh period
+    if (inv_pending && next > LV_DEF_REFR_PERIOD) next = LV_DEF_REFR_PERIOD;
+#else
+    if (next > LVGL_TASK_MAX_SLEEP_MS) next = LVGL_TASK_MAX_SLEEP_MS;
+#endif
+    return (next < 1) ? 1 : next;
 }
 
 /**
- * LVGL loop handler - MUST be called regularly!
+ * Render task: own cadence, independent of sensor/network code in loop().
+ * Blocks on its task notification, so lvgl_wake() ends the sleep early
+ * and the idle task (and with it automatic light sleep) gets the core.
+ */
+static void lvgl_task_entry(void* arg) {
+    for (;;) {
+        if (suspended) {
+            // Keep the UI queue drained so no update is lost, but leave
+            // timers and animations stopped until lvgl_set_suspended(false)
+            lvgl_lock();
+            if (frame_hook) frame_hook();
+            lvgl_unlock();
+            load_wakeups++;
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LVGL_TASK_MAX_IDLE_MS));
+            continue;
+        }
+        
+        uint32_t sleep_ms = lvgl_sleep_ms(lvgl_run_once());
+#if LVGL_GOVERNOR
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep_ms));
+#else
+        vTaskDelay(pdMS_TO_TICKS(sleep_ms));
+#endif
+    }
+}
+
+/**
+ * Wakes the render task (UI message queued)
+ */
+void lvgl_wake(void) {
+    if (lvgl_task != nullptr) xTaskNotifyGive(lvgl_task);
+}
+
+/**
+ * Suspends/resumes rendering (display blanked)
+ */
+void lvgl_set_suspended(bool on) {
+    suspended = on;
+    lvgl_wake();
+}
+
+bool lvgl_is_suspended(void) {
+    return suspended;
+}
+
+/**
+ * Sets the backlight PWM (Light_PWM, 0 = off)
+ */
+void lvgl_set_backlight(uint8_t level) {
+    tft.setBrightness(level);
+}
+
+/**
+ * LVGL loop handler (only needed before lvgl_start_task())
  */
 void lvgl_loop(void) {
-    // Update LVGL tick (IMPORTANT for LVGL 9!)
+    if (lvgl_task != nullptr) return;
+    lvgl_run_once();
+}
+
+/**
+ * Starts the render task
+ */
+bool lvgl_start_task(void (*hook)(void)) {
+    if (lvgl_task != nullptr) return true;
+    
+    frame_hook = hook;
+    if (xTaskCreatePinnedToCore(lvgl_task_entry, "lvgl", LVGL_TASK_STACK, nullptr,
+                                LVGL_TASK_PRIORITY, &lvgl_task, LVGL_TASK_CORE) != pdPASS) {
+        lvgl_task = nullptr;
+        Serial.println("[LVGL] ERROR: Render task could not be started!");
+        return false;
+    }
+    Serial.printf("[LVGL 9] Render task started on core %d\n", LVGL_TASK_CORE);
+    return true;
+}
+
+/**
+ * Locks LVGL for calls from other tasks
+ */
+void lvgl_lock(void) {
+    xSemaphoreTakeRecursive(lvgl_mutex, portMAX_DELAY);
+}
+
+void lvgl_unlock(void) {
+    xSemaphoreGiveRecursive(lvgl_mutex);
+    // Invalidated from another task: don't wait for the governor deadline
+    if (inv_pending && lvgl_task != nullptr && xTaskGetCurrentTaskHandle() != lvgl_task) {
+        lvgl_wake();
+    }
+}
+
+/**
+ * Profiler summary (averages and maxima since the last reset)
+ */
+static void prof_print_summary(void) {
+    uint32_t secs = (millis() - prof_start_ms) / 1000;
+    uint32_t n = prof_render.n ? prof_render.n : 1;
+    Serial.printf("[PROF] %lu frames/%lu s, render avg/max %lu/%lu us, flush avg/max %lu/%lu us, "
+                  "area avg %lu%%, %lu kpx/s\n",
+                  (unsigned long)prof_render.n, (unsigned long)secs,
+                  (unsigned long)(prof_render.sum / n), (unsigned long)prof_render.max,
+                  (unsigned long)(prof_flush.sum / n), (unsigned long)prof_flush.max,
+                  (unsigned long)(prof_area.sum / n),
+                  (unsigned long)(secs ? prof_total_px / secs / 1000 : 0));
+}
+
+/**
+ * Prints flush statistics
+ */
+void lvgl_print_stats(void) {
+    uint32_t avg = stat_frames ? (uint32_t)(stat_total_frame_us / stat_frames) : 0;
+    Serial.printf("[LVGL 9] Frames: %lu, bands: %lu, frame flush last/avg: %lu/%lu us (%s)\n",
+                  (unsigned long)stat_frames, (unsigned long)stat_bands,
+                  (unsigned long)stat_last_frame_us, (unsigned long)avg,
+                  direct_mode ? "direct" : flush_async ? "DMA async" : "blocking");
+    if (direct_mode) {
+        Serial.printf("[LVGL 9] Direct mode: %lu dirty areas sent as %lu windows\n",
+                      (unsigned long)stat_dirty_areas, (unsigned long)stat_bands);
+    }
+    
+    // Render task load since the last call
     uint32_t now = millis();
-    uint32_t elapsed = now - last_tick;
-    if (elapsed > 0) {
-        lv_tick_inc(elapsed);
-        last_tick = now;
+    uint32_t elapsed_ms = now - load_start_ms;
+    if (elapsed_ms > 0) {
+        Serial.printf("[LVGL 9] Render task: busy %.2f%%, %.1f wakeups/s (governor %s)\n",
+                      (float)load_busy_us / (elapsed_ms * 10.0f),
+                      load_wakeups * 1000.0f / elapsed_ms,
+                      LVGL_GOVERNOR ? "on" : "off");
+    }
+    load_start_ms = now;
+    load_busy_us = 0;
+    load_wakeups = 0;
+    
+    prof_print_summary();
+}
+
+static void prof_print_histogram(const ProfHistogram* h) {
+    Serial.printf("[PROF] %-9s", h->name);
+    for (int b = 0; b < LVGL_PROF_BUCKETS; b++) {
+        if (b < LVGL_PROF_BUCKETS - 1) {
+            Serial.printf(" <%lu:%lu", (unsigned long)h->edges[b], (unsigned long)h->counts[b]);
+        } else {
+            Serial.printf(" >=%lu:%lu", (unsigned long)h->edges[b - 1], (unsigned long)h->counts[b]);
+        }
+    }
+    Serial.printf("  (n=%lu max=%lu)\n", (unsigned long)h->n, (unsigned long)h->max);
+}
+
+void lvgl_profiler_dump(void) {
+    lvgl_lock();
+    prof_print_summary();
+    prof_print_histogram(&prof_render);
+    prof_print_histogram(&prof_flush);
+    prof_print_histogram(&prof_area);
+    prof_print_histogram(&prof_fps);
+    lvgl_unlock();
+}
+
+void lvgl_profiler_reset(void) {
+    lvgl_lock();
+    prof_clear(&prof_render);
+    prof_clear(&prof_flush);
+    prof_clear(&prof_area);
+    prof_clear(&prof_fps);
+    prof_total_px = 0;
+    prof_start_ms = millis();
+    lvgl_unlock();
+}
+
+void lvgl_profiler_set_overlay(bool on) {
+    lvgl_lock();
+    if (on && !prof_label) {
+        prof_label = lv_label_create(lv_layer_top());
+        lv_obj_set_style_bg_color(prof_label, lv_color_black(), 0);
+        lv_obj_set_style_bg_opa(prof_label, LV_OPA_70, 0);
+        lv_obj_set_style_text_color(prof_label, lv_color_hex(0x00ff00), 0);
+        lv_obj_set_style_pad_hor(prof_label, 4, 0);
+        lv_label_set_text(prof_label, "-- fps");
+        lv_obj_align(prof_label, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+    } else if (!on && prof_label) {
+        lv_obj_delete(prof_label);
+        prof_label = nullptr;
+    }
+    lvgl_unlock();
+}
+
+bool lvgl_profiler_overlay_enabled(void) {
+    return prof_label != nullptr;
+}
+
+/**
+ * Benchmark: full-screen redraws with blocking vs. async DMA flush
+ */
+void lvgl_benchmark_flush(void) {
+    const int rounds = 20;
+    lvgl_lock();
+    bool saved = flush_async;
+    
+    Serial.println("[LVGL 9] Flush benchmark (full-screen redraw):");
+    for (int mode = 0; mode < 2; mode++) {
+        // Same rule as use_render_mode(): no DMA straight from PSRAM, and
+        // direct_flush() has no async path
+        if (mode == 1 && (buf_in_psram || direct_mode)) {
+            Serial.printf("  %-9s skipped (%s)\n", "DMA async",
+                          direct_mode ? "direct mode flushes blocking" : "draw buffers in PSRAM");
+            continue;
+        }
+        flush_async = (mode == 1);
+        uint32_t t0 = micros();
+        for (int i = 0; i < rounds; i++) {
+            lv_obj_invalidate(lv_screen_active());
+            lv_refr_now(display);
+            lvgl_finish_frame();
+        }
+        uint32_t perFrame = (micros() - t0) / rounds;
+        Serial.printf("  %-9s %6lu us/frame  %5.1f FPS\n",
+                      direct_mode ? "direct" : flush_async ? "DMA async" : "blocking",
+                      (unsigned long)perFrame, perFrame ? 1000000.0f / perFrame : 0.0f);
+    }
+    flush_async = saved;
+    lvgl_unlock();
+}
+
+/**
+ * Benchmark: full-screen redraw time for each band height that fits
+ * into internal DMA RAM, then restores the selected buffers
+ */
+void lvgl_benchmark_bands(void) {
+    const int rounds = 20;
+    lvgl_lock();
+    uint16_t selected = band_lines;
+    bool selected_psram = buf_in_psram;
+    bool saved_direct = direct_mode;
+    direct_mode = false;
+    
+    Serial.println("[LVGL 9] Band height benchmark (full-screen redraw):");
+    for (int i = 0; i <= BAND_HEIGHT_COUNT; i++) {
+        // Last round: PSRAM with the default height for comparison
+        bool internal = (i < BAND_HEIGHT_COUNT);
+        uint16_t lines = internal ? BAND_HEIGHTS[i] : LVGL_BUF_SIZE / SCREEN_WIDTH;
+        
+        free_buffers();  // Own buffers do not count against the reserve
+        if (internal && !internal_fits(lines)) continue;
+        if (!alloc_buffers(lines, internal)) continue;
+        
+        size_t size = (size_t)SCREEN_WIDTH * lines * 2;
+        lv_display_set_buffers(display, buf1, buf2, size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+        flush_async = !buf_in_psram;
+        
+        uint32_t t0 = micros();
+        for (int r = 0; r < rounds; r++) {
+            lv_obj_invalidate(lv_screen_active());
+            lv_refr_now(display);
+            lvgl_finish_frame();
+        }
+        uint32_t perFrame = (micros() - t0) / rounds;
+        Serial.printf("  %2d lines %-8s %6lu us/frame  %5.1f FPS\n",
+                      lines, buf_in_psram ? "PSRAM" : "internal",
+                      (unsigned long)perFrame, perFrame ? 1000000.0f / perFrame : 0.0f);
+    }
+    
+    // Restore the selected configuration
+    if (selected == 0 || !alloc_buffers(selected, !selected_psram)) {
+        select_buffers();
+    }
+    restore_render_mode(saved_direct);
+    lvgl_unlock();
+}
+
+/**
+ * Benchmark: partial vs. direct mode, full-screen and scattered redraws
+ */
+void lvgl_benchmark_render_mode(void) {
+    const int rounds = 20;
+    bool saved_direct = direct_mode;
+    lvgl_lock();
+    
+    Serial.println("[LVGL 9] Render mode benchmark (full screen / 8 small areas):");
+    for (int mode = 0; mode < 2; mode++) {
+        if (!use_render_mode(mode == 1)) {
+            Serial.printf("  %-8s no memory\n", mode ? "direct" : "partial");
+            continue;
+        }
+        lv_refr_now(display);   // Fills a fresh framebuffer
+        lvgl_finish_frame();
+        
+        for (int scattered = 0; scattered < 2; scattered++) {
+            uint32_t windows = stat_bands;
+            uint32_t t0 = micros();
+            for (int r = 0; r < rounds; r++) {
+                if (!scattered) {
+                    lv_obj_invalidate(lv_screen_active());
+                } else {
+                    // 4 x 2 grid of 40x30 areas, like clock digits and values
+                    for (int i = 0; i < 8; i++) {
+                        lv_area_t a;
+                        a.x1 = 20 + (i % 4) * 115;
+                        a.y1 = 40 + (i / 4) * 160;
+                        a.x2 = a.x1 + 39;
+                        a.y2 = a.y1 + 29;
+                        lv_obj_invalidate_area(lv_screen_active(), &a);
+                    }
+                }
+                lv_refr_now(display);
+                lvgl_finish_frame();
+            }
+            uint32_t perFrame = (micros() - t0) / rounds;
+            Serial.printf("  %-8s %-10s %6lu us/frame  %5.1f windows/frame\n",
+                          direct_mode ? "direct" : "partial", scattered ? "scattered" : "full",
+                          (unsigned long)perFrame, (float)(stat_bands - windows) / rounds);
+        }
     }
     
-    // Process timers/tasks
-    lv_timer_handler();
+    restore_render_mode(saved_direct);
+    lvgl_unlock();
 }
 
 /**
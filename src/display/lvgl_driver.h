@@ -7,15 +7,48 @@
 #define LVGL_DRIVER_H
 
 #include <lvgl.h>
+#ifndef UI_HOST_BUILD
 #include "display_config.h"
+#endif
 
 // Display size
 #define SCREEN_WIDTH  480
 #define SCREEN_HEIGHT 320
 
-// Buffer size (1/10 of display)
+// Buffer size for the PSRAM fallback (1/10 of display)
 #define LVGL_BUF_SIZE (SCREEN_WIDTH * 32)
 
+// Render task
+#define LVGL_TASK_STACK         8192
+#define LVGL_TASK_PRIORITY      2       // Above loop() (1)
+#define LVGL_TASK_CORE          1
+
+// Frame governor: 1 = sleep until the next LVGL deadline or lvgl_wake(),
+// 0 = fixed polling (old behaviour, for before/after measurements)
+#define LVGL_GOVERNOR           1
+#define LVGL_TASK_MAX_SLEEP_MS  10      // Polling interval without governor
+#define LVGL_TASK_MAX_IDLE_MS   1000    // Longest governor sleep (safety net)
+
+// Render mode: 0 = partial bands (double-buffered, internal DMA RAM),
+// 1 = direct mode into one full-screen PSRAM framebuffer; the areas LVGL
+// redraws are coalesced into few SPI windows per frame
+#ifndef LVGL_RENDER_DIRECT
+#define LVGL_RENDER_DIRECT      0
+#endif
+#define LVGL_DIRTY_MAX          16      // Areas collected per frame (direct mode)
+#define LVGL_WINDOW_COST_PX     256     // SPI window setup in pixel equivalents:
+                                        // two areas merge if the bounding box
+                                        // costs less than both windows
+
+// Backlight PWM level after lvgl_init() (LovyanGFX Light_PWM, 0-255)
+#define LVGL_BACKLIGHT_FULL     255
+
+// Internal RAM left free when sizing the DMA draw buffers (WiFi, tasks)
+#define LVGL_INTERNAL_RESERVE (64 * 1024)
+
+// Frame profiler: buckets per histogram (render/flush time, area, FPS)
+#define LVGL_PROF_BUCKETS     8
+
 /**
  * Initializes LVGL and the display driver
  * Must be called BEFORE all other LVGL calls
@@ -23,14 +56,100 @@
 void lvgl_init(void);
 
 /**
- * Must be called regularly in loop
- * Processes LVGL timers and events
+ * Processes LVGL timers and renders once
+ * Only for setup(): does nothing once the render task runs
  */
 void lvgl_loop(void);
 
+/**
+ * Starts the pinned LVGL render task (call at the end of setup())
+ * @param hook Called by the task before every LVGL cycle with LVGL
+ *             locked (e.g. to apply queued UI updates), may be nullptr
+ */
+bool lvgl_start_task(void (*hook)(void));
+
+/**
+ * Wakes the render task before its next LVGL deadline, e.g. after a UI
+ * message was queued (safe from any task, no-op without render task)
+ */
+void lvgl_wake(void);
+
+/**
+ * Suspends rendering while the display is blanked: the render task stops
+ * LVGL timers (refresh, animations) and only applies queued UI messages
+ * through its hook. Resuming redraws whatever was invalidated meanwhile.
+ * Safe from any task.
+ */
+void lvgl_set_suspended(bool suspended);
+bool lvgl_is_suspended(void);
+
+/**
+ * Sets the backlight level (0 = off, LVGL_BACKLIGHT_FULL = full)
+ */
+void lvgl_set_backlight(uint8_t level);
+
+/**
+ * Completes a frame rendered with lv_refr_now(): waits for the last DMA
+ * transfer and releases the SPI bus (for benchmarks, LVGL locked)
+ */
+void lvgl_finish_frame(void);
+
+/**
+ * Locks/unlocks LVGL; any LVGL call from outside the render task must
+ * be wrapped in these (recursive)
+ */
+void lvgl_lock(void);
+void lvgl_unlock(void);
+
+/**
+ * Prints flush statistics (frames, bands, frame flush time) and the
+ * render task load since the last call (busy %, wakeups per second)
+ */
+void lvgl_print_stats(void);
+
+/**
+ * Frame profiler: prints render time, flush time, flushed area (% of the
+ * screen) and FPS histograms plus pixel throughput to Serial
+ * Format: "[PROF] render_us <1000:12 <2000:40 ... >=66000:0 (n=.. max=..)"
+ */
+void lvgl_profiler_dump(void);
+
+/**
+ * Clears all profiler histograms
+ */
+void lvgl_profiler_reset(void);
+
+/**
+ * Shows/hides the on-screen profiler overlay (bottom left, updated once
+ * per second; its own redraw is part of the measured frames)
+ */
+void lvgl_profiler_set_overlay(bool on);
+bool lvgl_profiler_overlay_enabled(void);
+
+/**
+ * Benchmark: full-screen redraw time with blocking vs. async DMA flush
+ * (prints results to Serial)
+ */
+void lvgl_benchmark_flush(void);
+
+/**
+ * Benchmark: full-screen redraw time per draw buffer band height
+ * (prints results to Serial)
+ */
+void lvgl_benchmark_bands(void);
+
+/**
+ * Benchmark: partial bands vs. direct PSRAM framebuffer, each with a
+ * full-screen redraw and with 8 scattered small areas per frame
+ * (prints time and SPI windows per frame, restores the build's mode)
+ */
+void lvgl_benchmark_render_mode(void);
+
+#ifndef UI_HOST_BUILD
 /**
  * Returns the TFT object (for direct access)
  */
 LGFX* lvgl_get_tft(void);
+#endif
 
 #endif // LVGL_DRIVER_H
@@ -0,0 +1,203 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - COMPRESSED IMAGE ASSETS
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "ui_assets.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+struct AssetSlot {
+    const ui_packed_image_t* packed;
+    lv_image_dsc_t dsc;
+    uint8_t* pixels;
+    uint16_t refs;
+};
+
+static AssetSlot slots[UI_ASSET_CACHE_SLOTS];
+
+// Statistics
+static uint32_t stat_decodes = 0;
+static uint32_t stat_hits = 0;
+static uint32_t stat_last_decode_us = 0;
+static uint32_t stat_max_decode_us = 0;
+static uint32_t stat_sprite_bytes = 0;
+static uint16_t stat_sprites = 0;
+
+/**
+ * LZ4 block decoder with bounds checks
+ * @return true if exactly dst_size bytes were produced
+ */
+static bool lz4_decode(const uint8_t* src, uint32_t src_size, uint8_t* dst, uint32_t dst_size) {
+    const uint8_t* ip = src;
+    const uint8_t* const ip_end = src + src_size;
+    uint8_t* op = dst;
+    uint8_t* const op_end = dst + dst_size;
+
+    while (ip < ip_end) {
+        uint8_t token = *ip++;
+
+        // Literals
+        uint32_t len = token >> 4;
+        if (len == 15) {
+            uint8_t b;
+            do {
+                if (ip >= ip_end) return false;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        if (len > (uint32_t)(ip_end - ip) || len > (uint32_t)(op_end - op)) return false;
+        memcpy(op, ip, len);
+        ip += len;
+        op += len;
+
+        // Last sequence has no match
+        if (ip >= ip_end) break;
+
+        // Match
+        if (ip_end - ip < 2) return false;
+        uint32_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (uint32_t)(op - dst)) return false;
+
+        len = token & 0x0F;
+        if (len == 15) {
+            uint8_t b;
+            do {
+                if (ip >= ip_end) return false;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += 4;
+        if (len > (uint32_t)(op_end - op)) return false;
+
+        // Byte copy: source and destination may overlap
+        const uint8_t* match = op - offset;
+        while (len--) {
+            *op++ = *match++;
+        }
+    }
+
+    return op == op_end;
+}
+
+static AssetSlot* find_slot(const ui_packed_image_t* packed) {
+    for (int i = 0; i < UI_ASSET_CACHE_SLOTS; i++) {
+        if (slots[i].packed == packed) return &slots[i];
+    }
+    return nullptr;
+}
+
+const lv_image_dsc_t* ui_asset_acquire(const ui_packed_image_t* packed) {
+    if (!packed) return nullptr;
+
+    AssetSlot* slot = find_slot(packed);
+    if (slot) {
+        slot->refs++;
+        stat_hits++;
+        return &slot->dsc;
+    }
+
+    slot = find_slot(nullptr);
+    if (!slot) {
+        Serial.printf("[ASSET] ERROR: No free cache slot for %s\n", packed->name);
+        return nullptr;
+    }
+
+    uint8_t* pixels = (uint8_t*)heap_caps_malloc(packed->raw_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!pixels) {
+        Serial.printf("[ASSET] ERROR: No PSRAM for %s (%lu bytes)\n",
+                      packed->name, (unsigned long)packed->raw_size);
+        return nullptr;
+    }
+
+    uint32_t t0 = micros();
+    if (!lz4_decode(packed->data, packed->packed_size, pixels, packed->raw_size)) {
+        Serial.printf("[ASSET] ERROR: %s is corrupt\n", packed->name);
+        heap_caps_free(pixels);
+        return nullptr;
+    }
+    stat_last_decode_us = micros() - t0;
+    if (stat_last_decode_us > stat_max_decode_us) stat_max_decode_us = stat_last_decode_us;
+    stat_decodes++;
+
+    memset(&slot->dsc, 0, sizeof(slot->dsc));
+    slot->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    slot->dsc.header.cf = packed->cf;
+    slot->dsc.header.w = packed->w;
+    slot->dsc.header.h = packed->h;
+    slot->dsc.header.stride = packed->stride;
+    slot->dsc.data_size = packed->raw_size;
+    slot->dsc.data = pixels;
+    slot->pixels = pixels;
+    slot->packed = packed;
+    slot->refs = 1;
+
+    Serial.printf("[ASSET] %s decoded: %lu -> %lu bytes in %lu us\n", packed->name,
+                  (unsigned long)packed->packed_size, (unsigned long)packed->raw_size,
+                  (unsigned long)stat_last_decode_us);
+    return &slot->dsc;
+}
+
+void ui_asset_release(const ui_packed_image_t* packed) {
+    if (!packed) return;
+
+    AssetSlot* slot = find_slot(packed);
+    if (!slot || slot->refs == 0) return;
+
+    if (--slot->refs == 0) {
+        // LVGL may still hold cache entries for this descriptor
+        lv_image_cache_drop(&slot->dsc);
+        heap_caps_free(slot->pixels);
+        memset(slot, 0, sizeof(*slot));
+    }
+}
+
+bool ui_sprite_alloc(lv_draw_buf_t* buf, uint32_t w, uint32_t h, lv_color_format_t cf) {
+    const uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    const uint32_t size = LV_ALIGN_UP(stride * h, LV_DRAW_BUF_ALIGN);
+
+    uint8_t* pixels = (uint8_t*)heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size,
+                                                        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!pixels) {
+        Serial.printf("[ASSET] ERROR: No PSRAM for %lux%lu sprite\n", (unsigned long)w, (unsigned long)h);
+        memset(buf, 0, sizeof(*buf));
+        return false;
+    }
+    memset(pixels, 0, size);
+    lv_draw_buf_init(buf, w, h, cf, stride, pixels, size);
+
+    stat_sprite_bytes += size;
+    stat_sprites++;
+    return true;
+}
+
+void ui_sprite_free(lv_draw_buf_t* buf) {
+    if (!buf || !buf->data) return;
+
+    lv_image_cache_drop(buf);
+    stat_sprite_bytes -= buf->data_size;
+    stat_sprites--;
+    heap_caps_free(buf->data);
+    memset(buf, 0, sizeof(*buf));
+}
+
+void ui_asset_print_stats(void) {
+    uint32_t resident = 0;
+    int count = 0;
+    for (int i = 0; i < UI_ASSET_CACHE_SLOTS; i++) {
+        if (slots[i].packed) {
+            resident += slots[i].packed->raw_size;
+            count++;
+        }
+    }
+    Serial.printf("[ASSET] %d resident (%lu KB PSRAM), decodes: %lu, hits: %lu, decode last/max: %lu/%lu us\n",
+                  count, (unsigned long)(resident / 1024),
+                  (unsigned long)stat_decodes, (unsigned long)stat_hits,
+                  (unsigned long)stat_last_decode_us, (unsigned long)stat_max_decode_us);
+    Serial.printf("[ASSET] %u runtime sprites (%lu KB PSRAM)\n",
+                  stat_sprites, (unsigned long)(stat_sprite_bytes / 1024));
+}
@@ -0,0 +1,82 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - COMPRESSED IMAGE ASSETS
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Large images are stored LZ4-compressed in flash (generated from the raw
+ * LVGL arrays in assets/images/ by tools/image_compress.py) and decoded
+ * into a PSRAM cache when a screen needs them:
+ *
+ *   lv_image_set_src(img, ui_asset_acquire(&img_tree_green_packed));
+ *   ...
+ *   ui_asset_release(&img_tree_green_packed);   // after the object is gone
+ *
+ * Acquire/release are reference counted; the pixels are freed with the
+ * last release.
+ */
+
+#ifndef UI_ASSETS_H
+#define UI_ASSETS_H
+
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * LZ4-compressed image (LZ4 block format, no frame header)
+ */
+typedef struct {
+    lv_color_format_t cf;
+    uint16_t w;
+    uint16_t h;
+    uint16_t stride;
+    uint32_t raw_size;          // Decoded size in bytes
+    uint32_t packed_size;
+    const uint8_t* data;
+    const char* name;
+} ui_packed_image_t;
+
+#define UI_PACKED_IMAGE_DECLARE(var_name) extern const ui_packed_image_t var_name##_packed
+
+#ifdef __cplusplus
+} /* extern "C" */
+
+// Decoded images cached at the same time
+#define UI_ASSET_CACHE_SLOTS  8
+
+/**
+ * Decodes an image into PSRAM (or returns the cached copy)
+ * @return Image descriptor for lv_image_set_src(), nullptr on error
+ */
+const lv_image_dsc_t* ui_asset_acquire(const ui_packed_image_t* packed);
+
+/**
+ * Drops one reference; the decoded pixels are freed with the last one.
+ * No LVGL object may still use the image.
+ */
+void ui_asset_release(const ui_packed_image_t* packed);
+
+/**
+ * Initializes a draw buffer with cleared (transparent) pixels in PSRAM, for
+ * images rendered once at runtime through an lv_canvas and then used as
+ * lv_image source
+ * @return false if there is not enough PSRAM
+ */
+bool ui_sprite_alloc(lv_draw_buf_t* buf, uint32_t w, uint32_t h, lv_color_format_t cf);
+
+/**
+ * Frees the pixels of a buffer from ui_sprite_alloc() (no-op if empty).
+ * No LVGL object may still use the image.
+ */
+void ui_sprite_free(lv_draw_buf_t* buf);
+
+/**
+ * Debug output (resident assets, decode times)
+ */
+void ui_asset_print_stats(void);
+
+#endif // __cplusplus
+
+#endif // UI_ASSETS_H
@@ -11,10 +11,17 @@
  */
 
 #include "ui_manager.h"
+#include "ui_assets.h"
+#include "lvgl_driver.h"
 #include <Arduino.h>
 #include <stdio.h>
 #include <string.h>
 #include "colors.h"  // For unified threshold values
+#include "utils/aqi_engine.h"
+#include "utils/lttb_decimator.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <esp_heap_caps.h>
 
 /* ═══════════════════════════════════════════════════════════════════════════
  * EMOJI BILDER (LVGL 9 kompatibel)
@@ -30,13 +37,13 @@ LV_IMAGE_DECLARE(emoji_icon_cloud);
 LV_IMAGE_DECLARE(emoji_icon_dash);
 LV_IMAGE_DECLARE(emoji_icon_nose);
 
-// Tree and leaves for tree animation
-LV_IMAGE_DECLARE(img_tree_green);
-LV_IMAGE_DECLARE(img_tree_yellow);
-LV_IMAGE_DECLARE(img_tree_red);
-LV_IMAGE_DECLARE(img_leaf_yellow);
-LV_IMAGE_DECLARE(img_leaf_yellow_mirrored);
-LV_IMAGE_DECLARE(img_leaf_red);
+// Tree and leaves for tree animation (LZ4-compressed, decoded to PSRAM)
+UI_PACKED_IMAGE_DECLARE(img_tree_green);
+UI_PACKED_IMAGE_DECLARE(img_tree_yellow);
+UI_PACKED_IMAGE_DECLARE(img_tree_red);
+UI_PACKED_IMAGE_DECLARE(img_leaf_yellow);
+UI_PACKED_IMAGE_DECLARE(img_leaf_yellow_mirrored);
+UI_PACKED_IMAGE_DECLARE(img_leaf_red);
 
 /* ═══════════════════════════════════════════════════════════════════════════
  * FONT KONFIGURATION
@@ -48,16 +55,12 @@ LV_IMAGE_DECLARE(img_leaf_red);
 #define FONT_48  &ui_font_48
 
 // Playfair Display fonts (Serif, for time/branding in analog screen)
-LV_FONT_DECLARE(playfair_12);
 LV_FONT_DECLARE(playfair_14);
 LV_FONT_DECLARE(playfair_20);
-LV_FONT_DECLARE(playfair_28);
 LV_FONT_DECLARE(playfair_32);
 LV_FONT_DECLARE(playfair_48);
-#define FONT_PLAYFAIR_12  &playfair_12
 #define FONT_PLAYFAIR_14  &playfair_14
 #define FONT_PLAYFAIR_20  &playfair_20
-#define FONT_PLAYFAIR_28  &playfair_28
 #define FONT_PLAYFAIR_32  &playfair_32
 #define FONT_PLAYFAIR_48  &playfair_48
 
@@ -67,12 +70,6 @@ LV_FONT_DECLARE(orbitron_16);
 #define FONT_ORBITRON_28  &orbitron_28
 #define FONT_ORBITRON_16  &orbitron_16
 
-// Extended Montserrat fonts (mit µ, ³, ², °)
-LV_FONT_DECLARE(ui_font_12_ext);
-LV_FONT_DECLARE(ui_font_16_ext);
-#define FONT_12_EXT  &ui_font_12_ext
-#define FONT_16_EXT  &ui_font_16_ext
-
 // Texte mit Umlauten
 #define TXT_LUFTQUALITAET   "Luftqualität"
 #define TXT_SEHR_GUT        "Sehr gut"
@@ -100,47 +97,9 @@ LV_FONT_DECLARE(ui_font_16_ext);
 #define COLOR_RING_BG   lv_color_hex(0xEEEEEE)
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * STATUS HELPER (shared) - Grenzwerte aus colors.h
+ * STATUS HELPER (shared) - Klassifizierung in utils/aqi_engine.h
  * ═══════════════════════════════════════════════════════════════════════════ */
-enum Status { GOOD = 0, WARN = 1, BAD = 2 };
-
-static Status get_temp_status(float t) {
-    if (t >= LIMIT_TEMP_GOOD_MIN && t <= LIMIT_TEMP_GOOD_MAX) return GOOD;
-    if (t >= LIMIT_TEMP_WARN_MIN && t <= LIMIT_TEMP_WARN_MAX) return WARN;
-    return BAD;
-}
-
-static Status get_hum_status(float h) {
-    if (h >= LIMIT_HUM_GOOD_MIN && h <= LIMIT_HUM_GOOD_MAX) return GOOD;
-    if (h >= LIMIT_HUM_WARN_MIN && h <= LIMIT_HUM_WARN_MAX) return WARN;
-    return BAD;
-}
-
-static Status get_co2_status(int c) {
-    if (c < LIMIT_CO2_GOOD) return GOOD;
-    if (c < LIMIT_CO2_BAD) return WARN;
-    return BAD;
-}
-
-static Status get_pm25_status(int p) {
-    if (p <= LIMIT_PM25_GOOD) return GOOD;
-    if (p <= LIMIT_PM25_BAD) return WARN;
-    return BAD;
-}
-
-static Status get_voc_status(int voc) {
-    if (voc <= LIMIT_VOC_GOOD) return GOOD;
-    if (voc <= LIMIT_VOC_BAD) return WARN;
-    return BAD;
-}
-
-static Status get_air_quality(int co2, int pm25) {
-    Status s1 = get_co2_status(co2);
-    Status s2 = get_pm25_status(pm25);
-    if (s1 == BAD || s2 == BAD) return BAD;
-    if (s1 == WARN || s2 == WARN) return WARN;
-    return GOOD;
-}
+enum Status { GOOD = AQI_STATUS_GOOD, WARN = AQI_STATUS_WARN, BAD = AQI_STATUS_BAD };
 
 static lv_color_t get_status_color(Status s) {
     if (s == GOOD) return COLOR_GOOD;
@@ -212,12 +171,105 @@ static void init_styles() {
     lv_style_set_radius(&style_bar_bad, 2);
 }
 
+/* ═══════════════════════════════════════════════════════════════════════════
+ * RETAINED WIDGET STATE (Screen 1 + 2)
+ * ═══════════════════════════════════════════════════════════════════════════
+ * Sensor updates arrive every 2 s but statuses change rarely. Every row
+ * remembers what was last pushed into LVGL (value text, status); the
+ * setters diff against it and only call LVGL on a real change. A skipped
+ * style swap saves a style refresh of the whole bar, a skipped text a
+ * label relayout plus the unit reposition.
+ */
+#define VIEW_UNSET  -1              // Nothing applied yet (new screen)
+
+enum SensorView : uint8_t {
+    VIEW_AQI,
+    VIEW_TEMP,
+    VIEW_HUM,
+    VIEW_CO2,                       // CO2, PM2.5, VOC: tiles of screen 2
+    VIEW_PM25,
+    VIEW_VOC,
+    VIEW_COUNT
+};
+
+struct Retained {
+    int8_t status;                  // Status or VIEW_UNSET
+    char text[10];                  // Value text, "" = unset
+};
+
+static uint32_t view_updates_applied = 0;
+static uint32_t view_updates_skipped = 0;
+
+static void retained_reset(Retained* views) {
+    for (int i = 0; i < VIEW_COUNT; i++) {
+        views[i].status = VIEW_UNSET;
+        views[i].text[0] = '\0';
+    }
+}
+
+// true (and remembered) if the status differs from the applied one
+static bool retained_status_changed(Retained* r, Status s) {
+    if (r->status == (int8_t)s) {
+        view_updates_skipped++;
+        return false;
+    }
+    r->status = (int8_t)s;
+    view_updates_applied++;
+    return true;
+}
+
+static bool retained_text_changed(Retained* r, const char* text) {
+    if (strncmp(r->text, text, sizeof(r->text)) == 0) {
+        view_updates_skipped++;
+        return false;
+    }
+    strncpy(r->text, text, sizeof(r->text) - 1);
+    r->text[sizeof(r->text) - 1] = '\0';
+    view_updates_applied++;
+    return true;
+}
+
+// Value label with the unit label placed right behind it
+static void view_set_value(Retained* r, lv_obj_t* value, lv_obj_t* unit, int32_t unit_y,
+                           const char* text) {
+    if (!retained_text_changed(r, text)) return;
+    lv_label_set_text(value, text);
+    lv_obj_update_layout(value);
+    lv_obj_set_pos(unit, lv_obj_get_x(value) + lv_obj_get_width(value) + 3, unit_y);
+}
+
+static void view_set_bar(Retained* r, lv_obj_t* bar, Status s) {
+    if (!retained_status_changed(r, s)) return;
+    lv_obj_remove_style(bar, NULL, LV_PART_INDICATOR);
+    lv_obj_add_style(bar, get_bar_style(s), LV_PART_INDICATOR);
+    lv_bar_set_value(bar, (s == GOOD) ? 33 : (s == WARN) ? 66 : 100, LV_ANIM_ON);
+}
+
+static void view_set_aqi(Retained* r, lv_obj_t* arc, lv_obj_t* label, lv_obj_t* emoji, Status air) {
+    if (!retained_status_changed(r, air)) return;
+    lv_color_t col = get_status_color(air);
+    lv_obj_set_style_arc_color(arc, col, LV_PART_INDICATOR);
+    lv_arc_set_value(arc, (air == GOOD) ? 100 : (air == WARN) ? 66 : 33);
+    lv_label_set_text(label, get_status_text(air));
+    lv_obj_set_style_text_color(label, col, 0);
+    lv_image_set_src(emoji, get_status_emoji_img(air));
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * SCREEN MANAGEMENT
  * ═══════════════════════════════════════════════════════════════════════════ */
-static lv_obj_t* screens[UI_SCREEN_COUNT] = {nullptr, nullptr, nullptr, nullptr, nullptr};
+static lv_obj_t* screens[UI_SCREEN_COUNT] = {nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
 static UIScreen current_screen = UI_SCREEN_TREE;
 
+// Screens are built on first use; below this much free LVGL heap the
+// least recently used inactive screens are deleted again
+#define UI_MEM_LOW_WATERMARK  (24 * 1024)
+static uint32_t screen_last_used[UI_SCREEN_COUNT] = {0};
+
+// Display blanked (ui_setPowerSave): the active screen collects dirty bits
+// like a hidden one and the tree leaves stop falling
+static bool ui_power_save = false;
+
 // Cached sensor values for screen updates
 static float cached_temp = 0;
 static float cached_hum = 0;
@@ -229,6 +281,17 @@ static int cached_min = 0;
 static int cached_sec = 0;
 static char cached_date[24] = "Di, 28. Jan 2026";
 
+// Classification of the cached values, computed once per sensor update
+static AqiResult cached_aqi = aqi_evaluate(0, 0, 0, 0, 0, 0);
+
+static Status channel_status(AqiChannel ch) {
+    return (Status)cached_aqi.channelStatus[ch];
+}
+
+static Status air_status() {
+    return (Status)cached_aqi.status;
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * SCREEN 0: TREE ANIMATION (Start Screen)
  * ═══════════════════════════════════════════════════════════════════════════
@@ -252,6 +315,189 @@ static lv_obj_t* s0_leaf_red = nullptr;
 static int s0_leaf_end_y = 290;  // Ground Y position for 320px height
 static Status s0_last_air_status = GOOD;
 
+// Tree images per status, decoded on first use and kept until teardown
+static const ui_packed_image_t* const s0_tree_packed[3] = {
+    &img_tree_green_packed, &img_tree_yellow_packed, &img_tree_red_packed
+};
+static const lv_image_dsc_t* s0_tree_dsc[3] = {nullptr, nullptr, nullptr};
+
+static const lv_image_dsc_t* s0_tree_image(Status s) {
+    if (!s0_tree_dsc[s]) {
+        s0_tree_dsc[s] = ui_asset_acquire(s0_tree_packed[s]);
+    }
+    return s0_tree_dsc[s];
+}
+
+/* Pre-rotated leaf sprites
+ * Rotating a scaled alpha image is the most expensive thing this screen
+ * draws, and the rotation animation did it on every frame. Instead every
+ * leaf is rendered once per angle into PSRAM when the screen is built, and
+ * the animation only picks the nearest frame (a plain, untransformed blit).
+ * The full-size leaf images are only needed while the frames are rendered. */
+#define S0_LEAF_SPRITES         1     // 0 = rotate live via lv_image_set_rotation()
+#define S0_LEAF_SCALE           48    // ~19% size (256 = 100%)
+#define S0_LEAF_ANGLE_MIN       -25   // Degrees, same range as the rotation animation
+#define S0_LEAF_ANGLE_STEP      5
+#define S0_LEAF_FRAMES          11    // -25° ... +25°
+#define S0_LEAF_SPRITE_SIZE     52    // Scaled leaf (38 px) rotated by 25°, +2 px AA margin
+
+static const ui_packed_image_t* const s0_leaf_packed[3] = {
+    &img_leaf_yellow_packed, &img_leaf_yellow_mirrored_packed, &img_leaf_red_packed
+};
+static const lv_image_dsc_t* s0_leaf_dsc[3] = {nullptr, nullptr, nullptr};  // Only for live rotation
+static lv_draw_buf_t s0_leaf_frames[3][S0_LEAF_FRAMES];
+static uint8_t* s0_leaf_sprite_mem = nullptr;
+static bool s0_leaf_use_sprites = false;
+static int8_t s0_leaf_frame[3] = {-1, -1, -1};
+
+static int s0_leaf_index(lv_obj_t* leaf) {
+    if (leaf == s0_leaf_yellow_1) return 0;
+    if (leaf == s0_leaf_yellow_2) return 1;
+    if (leaf == s0_leaf_red) return 2;
+    return -1;
+}
+
+static lv_obj_t* s0_leaf_obj(int i) {
+    return (i == 0) ? s0_leaf_yellow_1 : (i == 1) ? s0_leaf_yellow_2 : s0_leaf_red;
+}
+
+static void s0_free_leaf_sprites() {
+    if (!s0_leaf_sprite_mem) return;
+    for (int i = 0; i < 3; i++) {
+        for (int f = 0; f < S0_LEAF_FRAMES; f++) {
+            lv_image_cache_drop(&s0_leaf_frames[i][f]);
+        }
+    }
+    heap_caps_free(s0_leaf_sprite_mem);
+    s0_leaf_sprite_mem = nullptr;
+    s0_leaf_use_sprites = false;
+}
+
+/**
+ * Renders all rotation frames of the three leaves (ARGB8888, PSRAM)
+ * @return false if memory or a leaf image is missing (live rotation is used then)
+ */
+static bool s0_build_leaf_sprites(lv_obj_t* parent) {
+    const uint32_t stride = lv_draw_buf_width_to_stride(S0_LEAF_SPRITE_SIZE, LV_COLOR_FORMAT_ARGB8888);
+    const uint32_t frame_size = LV_ALIGN_UP(stride * S0_LEAF_SPRITE_SIZE, LV_DRAW_BUF_ALIGN);
+    const uint32_t total = frame_size * S0_LEAF_FRAMES * 3;
+
+    s0_leaf_sprite_mem = (uint8_t*)heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, total,
+                                                            MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!s0_leaf_sprite_mem) {
+        Serial.printf("[UI] Leaf sprites: no PSRAM for %lu bytes, rotating live\n", (unsigned long)total);
+        return false;
+    }
+    memset(s0_leaf_sprite_mem, 0, total);
+
+    uint32_t t0 = millis();
+    lv_obj_t* canvas = lv_canvas_create(parent);
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    bool ok = true;
+
+    for (int i = 0; i < 3 && ok; i++) {
+        const lv_image_dsc_t* src = ui_asset_acquire(s0_leaf_packed[i]);
+        if (!src) {
+            ok = false;
+            break;
+        }
+
+        // Leaf centered in the sprite, scaled and rotated around its center
+        lv_area_t area;
+        area.x1 = (S0_LEAF_SPRITE_SIZE - (int32_t)src->header.w) / 2;
+        area.y1 = (S0_LEAF_SPRITE_SIZE - (int32_t)src->header.h) / 2;
+        area.x2 = area.x1 + src->header.w - 1;
+        area.y2 = area.y1 + src->header.h - 1;
+
+        for (int f = 0; f < S0_LEAF_FRAMES; f++) {
+            lv_draw_buf_t* buf = &s0_leaf_frames[i][f];
+            uint8_t* data = s0_leaf_sprite_mem + (i * S0_LEAF_FRAMES + f) * frame_size;
+            lv_draw_buf_init(buf, S0_LEAF_SPRITE_SIZE, S0_LEAF_SPRITE_SIZE,
+                             LV_COLOR_FORMAT_ARGB8888, stride, data, frame_size);
+            lv_canvas_set_draw_buf(canvas, buf);
+
+            lv_layer_t layer;
+            lv_canvas_init_layer(canvas, &layer);
+
+            lv_draw_image_dsc_t dsc;
+            lv_draw_image_dsc_init(&dsc);
+            dsc.src = src;
+            dsc.scale_x = S0_LEAF_SCALE;
+            dsc.scale_y = S0_LEAF_SCALE;
+            dsc.rotation = (S0_LEAF_ANGLE_MIN + f * S0_LEAF_ANGLE_STEP) * 10;
+            dsc.pivot.x = src->header.w / 2;
+            dsc.pivot.y = src->header.h / 2;
+            dsc.antialias = 1;
+            lv_draw_image(&layer, &dsc, &area);
+
+            lv_canvas_finish_layer(canvas, &layer);
+        }
+
+        // The frames are all that is needed from now on
+        ui_asset_release(s0_leaf_packed[i]);
+    }
+
+    lv_obj_delete(canvas);
+
+    if (!ok) {
+        Serial.println("[UI] Leaf sprites: leaf image missing, rotating live");
+        s0_free_leaf_sprites();
+        return false;
+    }
+
+    Serial.printf("[UI] Leaf sprites: %d frames x 3 leaves (%dx%d), %lu KB PSRAM, %lu ms\n",
+                  S0_LEAF_FRAMES, S0_LEAF_SPRITE_SIZE, S0_LEAF_SPRITE_SIZE,
+                  (unsigned long)(total / 1024), (unsigned long)(millis() - t0));
+    return true;
+}
+
+// Rotation animation exec_cb: picks a sprite frame, or rotates live as fallback
+static void s0_set_leaf_angle(void* obj, int32_t deg) {
+    lv_obj_t* leaf = (lv_obj_t*)obj;
+    int i = s0_leaf_index(leaf);
+    if (i < 0) return;
+
+    if (!s0_leaf_use_sprites) {
+        lv_image_set_rotation(leaf, deg * 10);
+        return;
+    }
+
+    int f = (deg - S0_LEAF_ANGLE_MIN + S0_LEAF_ANGLE_STEP / 2) / S0_LEAF_ANGLE_STEP;
+    if (f < 0) f = 0;
+    if (f >= S0_LEAF_FRAMES) f = S0_LEAF_FRAMES - 1;
+
+    // Only invalidate when the frame actually changes
+    if (f != s0_leaf_frame[i]) {
+        s0_leaf_frame[i] = f;
+        lv_image_set_src(leaf, &s0_leaf_frames[i][f]);
+    }
+}
+
+// Switches all leaves between sprite frames and live rotation
+static void s0_set_leaf_mode(bool sprites) {
+    s0_leaf_use_sprites = sprites && s0_leaf_sprite_mem;
+
+    for (int i = 0; i < 3; i++) {
+        lv_obj_t* leaf = s0_leaf_obj(i);
+        if (!leaf) continue;
+
+        if (s0_leaf_use_sprites) {
+            lv_image_set_scale(leaf, LV_SCALE_NONE);
+            lv_image_set_rotation(leaf, 0);
+            s0_leaf_frame[i] = -1;
+            s0_set_leaf_angle(leaf, 0);
+            if (s0_leaf_dsc[i]) {
+                ui_asset_release(s0_leaf_packed[i]);
+                s0_leaf_dsc[i] = nullptr;
+            }
+        } else {
+            if (!s0_leaf_dsc[i]) s0_leaf_dsc[i] = ui_asset_acquire(s0_leaf_packed[i]);
+            lv_image_set_src(leaf, s0_leaf_dsc[i]);
+            lv_image_set_scale(leaf, S0_LEAF_SCALE);
+        }
+    }
+}
+
 // Forward declarations for leaf animations
 static void s0_animate_yellow_leaf_from_branch(lv_obj_t* leaf, float branch_x_ratio, float branch_y_ratio, int sway, uint32_t delay_ms, int end_y_offset);
 static void s0_animate_red_leaf_from_branch(lv_obj_t* leaf);
@@ -342,7 +588,7 @@ static void s0_animate_yellow_leaf_from_branch(lv_obj_t* leaf, float branch_x_ra
     lv_anim_set_playback_duration(&a_rot, 800 + (rand() % 400));
     lv_anim_set_repeat_count(&a_rot, LV_ANIM_REPEAT_INFINITE);
     lv_anim_set_delay(&a_rot, hang_ms + delay_ms);
-    lv_anim_set_exec_cb(&a_rot, [](void* obj, int32_t v) { lv_image_set_rotation((lv_obj_t*)obj, v * 10); });
+    lv_anim_set_exec_cb(&a_rot, s0_set_leaf_angle);
     lv_anim_start(&a_rot);
 }
 
@@ -410,7 +656,7 @@ static void s0_animate_red_leaf_from_branch(lv_obj_t* leaf)
     lv_anim_set_playback_duration(&a_rot, 600 + (rand() % 300));
     lv_anim_set_delay(&a_rot, 3500);
     lv_anim_set_repeat_count(&a_rot, LV_ANIM_REPEAT_INFINITE);
-    lv_anim_set_exec_cb(&a_rot, [](void* obj, int32_t v) { lv_image_set_rotation((lv_obj_t*)obj, v * 10); });
+    lv_anim_set_exec_cb(&a_rot, s0_set_leaf_angle);
     lv_anim_start(&a_rot);
 }
 
@@ -440,7 +686,7 @@ static void s0_show_green()
 {
     if (!s0_tree_img) return;
     
-    lv_image_set_src(s0_tree_img, &img_tree_green);
+    lv_image_set_src(s0_tree_img, s0_tree_image(GOOD));
 
     // Stop animations and hide leaves
     if (s0_leaf_yellow_1) {
@@ -461,7 +707,7 @@ static void s0_show_yellow()
 {
     if (!s0_tree_img) return;
     
-    lv_image_set_src(s0_tree_img, &img_tree_yellow);
+    lv_image_set_src(s0_tree_img, s0_tree_image(WARN));
 
     // Alte Animationen stoppen
     if (s0_leaf_yellow_1) lv_anim_delete(s0_leaf_yellow_1, NULL);
@@ -486,7 +732,7 @@ static void s0_show_red()
 {
     if (!s0_tree_img) return;
     
-    lv_image_set_src(s0_tree_img, &img_tree_red);
+    lv_image_set_src(s0_tree_img, s0_tree_image(BAD));
 
     // Alte Animationen stoppen
     if (s0_leaf_yellow_1) {
@@ -523,7 +769,7 @@ static void create_screen0_tree() {
     
     // Baum-Bild erstellen und zentrieren
     s0_tree_img = lv_image_create(scr);
-    lv_image_set_src(s0_tree_img, &img_tree_green);
+    lv_image_set_src(s0_tree_img, s0_tree_image(GOOD));
     lv_image_set_scale(s0_tree_img, 320);  // ~125% size (256 = 100%)
     
     // Update layout to get size
@@ -540,22 +786,20 @@ static void create_screen0_tree() {
 
     // Gelbes Blatt 1 (links)
     s0_leaf_yellow_1 = lv_image_create(scr);
-    lv_image_set_src(s0_leaf_yellow_1, &img_leaf_yellow);
-    lv_image_set_scale(s0_leaf_yellow_1, 48);  // ~19% size
     lv_obj_add_flag(s0_leaf_yellow_1, LV_OBJ_FLAG_HIDDEN);
 
     // Gelbes Blatt 2 (rechts, gespiegelt)
     s0_leaf_yellow_2 = lv_image_create(scr);
-    lv_image_set_src(s0_leaf_yellow_2, &img_leaf_yellow_mirrored);
-    lv_image_set_scale(s0_leaf_yellow_2, 48);
     lv_obj_add_flag(s0_leaf_yellow_2, LV_OBJ_FLAG_HIDDEN);
 
     // Rotes Blatt
     s0_leaf_red = lv_image_create(scr);
-    lv_image_set_src(s0_leaf_red, &img_leaf_red);
-    lv_image_set_scale(s0_leaf_red, 48);
     lv_obj_add_flag(s0_leaf_red, LV_OBJ_FLAG_HIDDEN);
 
+    // Blätter: vorgerenderte Rotationsframes, sonst Live-Rotation
+    bool sprites = S0_LEAF_SPRITES && s0_build_leaf_sprites(scr);
+    s0_set_leaf_mode(sprites);
+
     // Initial: green tree (good air quality)
     s0_last_air_status = GOOD;
     s0_show_green();
@@ -567,7 +811,7 @@ static void create_screen0_tree() {
 // Update tree screen based on air quality
 // ------------------------------------------------------------
 static void update_screen0_tree() {
-    Status air = get_air_quality(cached_co2, cached_pm25);
+    Status air = air_status();
     
     // Only update when state has changed
     if (air != s0_last_air_status) {
@@ -590,6 +834,223 @@ static void update_screen0_tree() {
     }
 }
 
+// Stops the leaves while the display is blanked, restarts them afterwards
+static void s0_pause_leaves(bool pause) {
+    if (!s0_tree_img) return;
+    
+    if (pause) {
+        for (int i = 0; i < 3; i++) {
+            lv_obj_t* leaf = s0_leaf_obj(i);
+            if (!leaf) continue;
+            lv_anim_delete(leaf, NULL);
+            lv_obj_add_flag(leaf, LV_OBJ_FLAG_HIDDEN);
+        }
+    } else if (s0_last_air_status == WARN) {
+        s0_show_yellow();
+    } else if (s0_last_air_status == BAD) {
+        s0_show_red();
+    }
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * DIGIT CLOCK (Screen 1 + 2)
+ * ═══════════════════════════════════════════════════════════════════════════
+ * "HH:MM" (FONT_48) and seconds (FONT_28) as rows of lv_image cells. Each
+ * font is rendered once into a glyph atlas: '0'-'9' in equally wide cells
+ * plus ':', opaque RGB565 on COLOR_BG (both screens draw the clock directly
+ * on the plain screen background). A tick only swaps the source of the
+ * cells whose digit changed - fixed cell sizes mean no label shaping, no
+ * relayout, and LVGL invalidates just those cell rectangles.
+ */
+#define CLOCK_GLYPHS      11    // '0'-'9', ':'
+#define CLOCK_CELLS       7     // H H : M M + S S
+#define CLOCK_SEC_GAP     3     // Gap between minutes and seconds (px)
+#define CLOCK_SEC_DY      10    // Seconds row offset (smaller font)
+
+struct GlyphAtlas {
+    lv_draw_buf_t glyphs[CLOCK_GLYPHS];
+    int32_t digit_w;            // Width of every digit cell
+    int32_t colon_w;
+    int32_t height;
+};
+
+struct DigitClock {
+    lv_obj_t* cells[CLOCK_CELLS];
+    char shown[CLOCK_CELLS];    // Character per cell, 0 = not set yet
+    lv_obj_t* lbl_time;         // Fallback without atlas (labels + relayout)
+    lv_obj_t* lbl_seconds;
+};
+
+static GlyphAtlas clock_atlas_time;     // FONT_48, COLOR_TEXT
+static GlyphAtlas clock_atlas_sec;      // FONT_28, COLOR_TEXT_L
+static int clock_atlas_users = 0;
+
+static const char* const CLOCK_GLYPH_TEXT[CLOCK_GLYPHS] = {
+    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", ":"
+};
+
+static void clock_free_atlas(GlyphAtlas* atlas) {
+    for (int i = 0; i < CLOCK_GLYPHS; i++) {
+        ui_sprite_free(&atlas->glyphs[i]);
+    }
+}
+
+/**
+ * Renders the glyphs of a font into an atlas
+ * @return false if PSRAM is missing (the clock falls back to labels)
+ */
+static bool clock_build_atlas(GlyphAtlas* atlas, lv_obj_t* parent,
+                              const lv_font_t* font, lv_color_t color) {
+    atlas->digit_w = 0;
+    for (char c = '0'; c <= '9'; c++) {
+        int32_t w = lv_font_get_glyph_width(font, c, 0);
+        if (w > atlas->digit_w) atlas->digit_w = w;
+    }
+    atlas->colon_w = lv_font_get_glyph_width(font, ':', 0);
+    atlas->height = lv_font_get_line_height(font);
+
+    lv_obj_t* canvas = lv_canvas_create(parent);
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    bool ok = true;
+
+    for (int i = 0; i < CLOCK_GLYPHS && ok; i++) {
+        int32_t w = (i < 10) ? atlas->digit_w : atlas->colon_w;
+        if (!ui_sprite_alloc(&atlas->glyphs[i], w, atlas->height, LV_COLOR_FORMAT_RGB565)) {
+            ok = false;
+            break;
+        }
+        lv_canvas_set_draw_buf(canvas, &atlas->glyphs[i]);
+        lv_canvas_fill_bg(canvas, COLOR_BG, LV_OPA_COVER);
+
+        lv_layer_t layer;
+        lv_canvas_init_layer(canvas, &layer);
+
+        // Digits centered in their cell (proportional font, fixed cells)
+        lv_draw_label_dsc_t dsc;
+        lv_draw_label_dsc_init(&dsc);
+        dsc.font = font;
+        dsc.color = color;
+        dsc.align = LV_TEXT_ALIGN_CENTER;
+        dsc.text = CLOCK_GLYPH_TEXT[i];
+        lv_area_t area = {0, 0, w - 1, atlas->height - 1};
+        lv_draw_label(&layer, &dsc, &area);
+
+        lv_canvas_finish_layer(canvas, &layer);
+    }
+
+    lv_obj_delete(canvas);
+    if (!ok) clock_free_atlas(atlas);
+    return ok;
+}
+
+// Both atlases are shared by all clocks and built with the first one
+static bool clock_acquire_atlas(lv_obj_t* parent) {
+    if (clock_atlas_users == 0) {
+        uint32_t t0 = micros();
+        if (!clock_build_atlas(&clock_atlas_time, parent, FONT_48, COLOR_TEXT)) return false;
+        if (!clock_build_atlas(&clock_atlas_sec, parent, FONT_28, COLOR_TEXT_L)) {
+            clock_free_atlas(&clock_atlas_time);
+            return false;
+        }
+        Serial.printf("[UI] Clock glyph atlas: %ldx%ld + %ldx%ld cells in %lu us\n",
+                      (long)clock_atlas_time.digit_w, (long)clock_atlas_time.height,
+                      (long)clock_atlas_sec.digit_w, (long)clock_atlas_sec.height,
+                      (unsigned long)(micros() - t0));
+    }
+    clock_atlas_users++;
+    return true;
+}
+
+static lv_obj_t* clock_create_cell(lv_obj_t* parent, const GlyphAtlas* atlas,
+                                   int32_t x, int32_t y, int32_t w) {
+    lv_obj_t* cell = lv_image_create(parent);
+    lv_obj_set_pos(cell, x, y);
+    lv_obj_set_size(cell, w, atlas->height);    // Fixed: new sources never relayout
+    return cell;
+}
+
+/**
+ * Creates the clock with "HH:MM" at (x, y) and the seconds right of it
+ */
+static void clock_create(DigitClock* clock, lv_obj_t* parent, int32_t x, int32_t y) {
+    memset(clock, 0, sizeof(*clock));
+
+    if (!clock_acquire_atlas(parent)) {
+        clock->lbl_time = lv_label_create(parent);
+        lv_obj_set_style_text_font(clock->lbl_time, FONT_48, 0);
+        lv_obj_set_style_text_color(clock->lbl_time, COLOR_TEXT, 0);
+        lv_label_set_text(clock->lbl_time, "00:00");
+        lv_obj_set_pos(clock->lbl_time, x, y);
+
+        clock->lbl_seconds = lv_label_create(parent);
+        lv_obj_set_style_text_font(clock->lbl_seconds, FONT_28, 0);
+        lv_obj_set_style_text_color(clock->lbl_seconds, COLOR_TEXT_L, 0);
+        lv_label_set_text(clock->lbl_seconds, "00");
+        lv_obj_set_pos(clock->lbl_seconds, x + 124, y + CLOCK_SEC_DY);
+        return;
+    }
+
+    const GlyphAtlas* t = &clock_atlas_time;
+    const GlyphAtlas* s = &clock_atlas_sec;
+    int32_t cx = x;
+    for (int i = 0; i < 5; i++) {
+        int32_t w = (i == 2) ? t->colon_w : t->digit_w;
+        clock->cells[i] = clock_create_cell(parent, t, cx, y, w);
+        cx += w;
+    }
+    cx += CLOCK_SEC_GAP;
+    for (int i = 5; i < CLOCK_CELLS; i++) {
+        clock->cells[i] = clock_create_cell(parent, s, cx, y + CLOCK_SEC_DY, s->digit_w);
+        cx += s->digit_w;
+    }
+
+    // The colon never changes
+    lv_image_set_src(clock->cells[2], &t->glyphs[10]);
+    clock->shown[2] = ':';
+}
+
+/**
+ * Shows the time, touching only cells whose digit changed
+ */
+static void clock_set(DigitClock* clock, int hour, int min, int sec) {
+    if (!clock->cells[0]) {
+        if (!clock->lbl_time) return;
+
+        char buf[8];
+        snprintf(buf, sizeof(buf), "%02d:%02d", hour, min);
+        lv_label_set_text(clock->lbl_time, buf);
+        snprintf(buf, sizeof(buf), "%02d", sec);
+        lv_label_set_text(clock->lbl_seconds, buf);
+
+        lv_obj_update_layout(clock->lbl_time);
+        lv_obj_set_pos(clock->lbl_seconds,
+                       lv_obj_get_x(clock->lbl_time) + lv_obj_get_width(clock->lbl_time) + CLOCK_SEC_GAP,
+                       lv_obj_get_y(clock->lbl_time) + CLOCK_SEC_DY);
+        return;
+    }
+
+    const char text[CLOCK_CELLS] = {
+        (char)('0' + hour / 10), (char)('0' + hour % 10), ':',
+        (char)('0' + min / 10),  (char)('0' + min % 10),
+        (char)('0' + sec / 10),  (char)('0' + sec % 10)
+    };
+    for (int i = 0; i < CLOCK_CELLS; i++) {
+        if (text[i] == clock->shown[i]) continue;
+        GlyphAtlas* atlas = (i < 5) ? &clock_atlas_time : &clock_atlas_sec;
+        lv_image_set_src(clock->cells[i], &atlas->glyphs[text[i] - '0']);
+        clock->shown[i] = text[i];
+    }
+}
+
+// Screen deleted: drop the cell pointers, free the atlas with the last clock
+static void clock_release(DigitClock* clock) {
+    if (clock->cells[0] && --clock_atlas_users == 0) {
+        clock_free_atlas(&clock_atlas_time);
+        clock_free_atlas(&clock_atlas_sec);
+    }
+    memset(clock, 0, sizeof(*clock));
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * SCREEN 1: OVERVIEW (Large AQI + 2 large tiles)
  * ═══════════════════════════════════════════════════════════════════════════
@@ -606,8 +1067,8 @@ static void update_screen0_tree() {
  */
 
 // Screen 1 UI elements
-static lv_obj_t* s1_lbl_time = nullptr;
-static lv_obj_t* s1_lbl_seconds = nullptr;
+static DigitClock s1_clock;
+static Retained s1_views[VIEW_COUNT];
 static lv_obj_t* s1_lbl_date = nullptr;
 static lv_obj_t* s1_aqi_box = nullptr;
 static lv_obj_t* s1_arc_aqi = nullptr;
@@ -635,6 +1096,7 @@ static void create_screen1() {
     lv_obj_t* scr = screens[UI_SCREEN_OVERVIEW];
     lv_obj_set_style_bg_color(scr, COLOR_BG, 0);
     lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    retained_reset(s1_views);
 
     // Layout constants for screen 1
     const int AQI_BOX_W = 180;
@@ -649,17 +1111,7 @@ static void create_screen1() {
     // ─────────────────────────────────────────────────────────────────────
     // UHRZEIT (oben links) - gleiche Position wie Screen 2
     // ─────────────────────────────────────────────────────────────────────
-    s1_lbl_time = lv_label_create(scr);
-    lv_obj_set_style_text_font(s1_lbl_time, FONT_48, 0);
-    lv_obj_set_style_text_color(s1_lbl_time, COLOR_TEXT, 0);
-    lv_label_set_text(s1_lbl_time, "00:00");
-    lv_obj_set_pos(s1_lbl_time, 65, 55);
-
-    s1_lbl_seconds = lv_label_create(scr);
-    lv_obj_set_style_text_font(s1_lbl_seconds, FONT_28, 0);
-    lv_obj_set_style_text_color(s1_lbl_seconds, COLOR_TEXT_L, 0);
-    lv_label_set_text(s1_lbl_seconds, "00");
-    lv_obj_set_pos(s1_lbl_seconds, 189, 65);
+    clock_create(&s1_clock, scr, 65, 55);
 
     s1_lbl_date = lv_label_create(scr);
     lv_obj_set_style_text_font(s1_lbl_date, FONT_16, 0);
@@ -810,8 +1262,8 @@ static void create_screen1() {
  */
 
 // Screen 2 UI elements
-static lv_obj_t* s2_lbl_time = nullptr;
-static lv_obj_t* s2_lbl_seconds = nullptr;
+static DigitClock s2_clock;
+static Retained s2_views[VIEW_COUNT];
 static lv_obj_t* s2_lbl_date = nullptr;
 static lv_obj_t* s2_arc_aqi = nullptr;
 static lv_obj_t* s2_img_emoji = nullptr;
@@ -848,6 +1300,7 @@ static void create_screen2() {
     lv_obj_t* scr = screens[UI_SCREEN_DETAIL];
     lv_obj_set_style_bg_color(scr, COLOR_BG, 0);
     lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    retained_reset(s2_views);
 
     // Layout-Konstanten (wie bisherige UI)
     const int AQI_BOX_X = 270;
@@ -864,17 +1317,7 @@ static void create_screen2() {
     // ─────────────────────────────────────────────────────────────────────
     // UHRZEIT
     // ─────────────────────────────────────────────────────────────────────
-    s2_lbl_time = lv_label_create(scr);
-    lv_obj_set_style_text_font(s2_lbl_time, FONT_48, 0);
-    lv_obj_set_style_text_color(s2_lbl_time, COLOR_TEXT, 0);
-    lv_label_set_text(s2_lbl_time, "00:00");
-    lv_obj_set_pos(s2_lbl_time, 65, 55);
-
-    s2_lbl_seconds = lv_label_create(scr);
-    lv_obj_set_style_text_font(s2_lbl_seconds, FONT_28, 0);
-    lv_obj_set_style_text_color(s2_lbl_seconds, COLOR_TEXT_L, 0);
-    lv_label_set_text(s2_lbl_seconds, "00");
-    lv_obj_set_pos(s2_lbl_seconds, 189, 65);
+    clock_create(&s2_clock, scr, 65, 55);
 
     s2_lbl_date = lv_label_create(scr);
     lv_obj_set_style_text_font(s2_lbl_date, FONT_16, 0);
@@ -1079,10 +1522,13 @@ static void create_screen2() {
 #define COLOR_CO2_GAUGE      lv_color_hex(0x9b59b6)
 #define COLOR_HUM_GAUGE      lv_color_hex(0x3498db)
 
+// Needle motion: animated towards the new value, one small redraw per step
+#define S3_NEEDLE_ANIM_MS    600
+
 // Gauge structure for analog screen
 typedef struct {
     lv_obj_t* container;
-    lv_obj_t* arc_bg;
+    lv_obj_t* arc_bg;           // Static face parts: nullptr once flattened
     lv_obj_t* arc_fill;
     lv_obj_t* needle;
     lv_obj_t* needle_center;
@@ -1090,6 +1536,9 @@ typedef struct {
     lv_point_precise_t tick_points[12][2];
     lv_obj_t* value_label;
     lv_obj_t* name_label;
+    lv_point_precise_t* needle_pts;
+    int32_t needle_permille;    // Displayed position (0..1000, animated)
+    int32_t needle_angle;       // Displayed angle in degrees (-1 = not drawn yet)
     float current_value;
     float min_val;
     float max_val;
@@ -1116,39 +1565,97 @@ static lv_point_precise_t s3_needle_pts_temp[2];
 static lv_point_precise_t s3_needle_pts_co2[2];
 static lv_point_precise_t s3_needle_pts_hum[2];
 
+// Static face (screen bg, golden border, background arcs, ticks, fixed
+// labels) flattened into one RGB565 image
+static lv_draw_buf_t s3_face_buf;
+
+// ------------------------------------------------------------
+// Zeiger + Arc auf Position setzen (0..1000 = min..max)
+// ------------------------------------------------------------
+static void s3_set_needle(AnalogGauge* g, int32_t permille) {
+    g->needle_permille = permille;
+    lv_arc_set_value(g->arc_fill, permille / 10);  // No-op if unchanged
+
+    // 180° = links, 360° = rechts; 1° steps, integer sine table
+    int32_t angle = 180 + permille * 180 / 1000;
+    if (angle == g->needle_angle) return;
+    g->needle_angle = angle;
+
+    int32_t nx = g->cx + g->needle_len * lv_trigo_cos(angle) / LV_TRIGO_SIN_MAX;
+    int32_t ny = g->cy + g->needle_len * lv_trigo_sin(angle) / LV_TRIGO_SIN_MAX;
+
+    // The line object only spans the needle itself, so a step invalidates
+    // the old and new needle bounding box instead of the whole gauge
+    int32_t x0 = LV_MIN(g->cx, nx);
+    int32_t y0 = LV_MIN(g->cy, ny);
+    g->needle_pts[0].x = g->cx - x0;
+    g->needle_pts[0].y = g->cy - y0;
+    g->needle_pts[1].x = nx - x0;
+    g->needle_pts[1].y = ny - y0;
+    lv_obj_set_pos(g->needle, x0, y0);
+    lv_line_set_points(g->needle, g->needle_pts, 2);
+}
+
+static void s3_needle_anim_cb(void* var, int32_t v) {
+    s3_set_needle((AnalogGauge*)var, v);
+}
+
 // ------------------------------------------------------------
 // Gauge Update Funktion
 // ------------------------------------------------------------
-static void s3_update_gauge(AnalogGauge* g, lv_point_precise_t* pts) {
+static void s3_update_gauge(AnalogGauge* g) {
     float clampedValue = g->current_value;
     if (clampedValue < g->min_val) clampedValue = g->min_val;
     if (clampedValue > g->max_val) clampedValue = g->max_val;
-    float ratio = (clampedValue - g->min_val) / (g->max_val - g->min_val);
-
-    // Arc Update
-    lv_arc_set_value(g->arc_fill, (int)(ratio * 100));
-
-    // Zeiger Update (180° = links, 360° = rechts)
-    float needle_angle_deg = 180.0f + ratio * 180.0f;
-    float needle_rad = needle_angle_deg * (float)M_PI / 180.0f;
-
-    int nx = g->cx + (int)(g->needle_len * cosf(needle_rad));
-    int ny = g->cy + (int)(g->needle_len * sinf(needle_rad));
-
-    pts[0].x = g->cx;
-    pts[0].y = g->cy;
-    pts[1].x = nx;
-    pts[1].y = ny;
-    lv_line_set_points(g->needle, pts, 2);
+    int32_t target = (int32_t)((clampedValue - g->min_val) / (g->max_val - g->min_val) * 1000.0f);
+
+    // Zeiger animiert zum neuen Wert bewegen
+    lv_anim_delete(g, s3_needle_anim_cb);
+    if (target != g->needle_permille) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, g);
+        lv_anim_set_values(&a, g->needle_permille, target);
+        lv_anim_set_duration(&a, S3_NEEDLE_ANIM_MS);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_set_exec_cb(&a, s3_needle_anim_cb);
+        lv_anim_start(&a);
+    }
 
-    // Wert Label
+    // Wert Label (nur bei Änderung neu zeichnen)
     char buf[16];
     if (g->is_big) {
         snprintf(buf, sizeof(buf), "%d %s", (int)g->current_value, g->unit);
     } else {
         snprintf(buf, sizeof(buf), "%.1f %s", g->current_value, g->unit);
     }
-    lv_label_set_text(g->value_label, buf);
+    if (strcmp(lv_label_get_text(g->value_label), buf) != 0) {
+        lv_label_set_text(g->value_label, buf);
+    }
+}
+
+// ------------------------------------------------------------
+// Zeiger erstellen (kleine und große Gauge)
+// ------------------------------------------------------------
+static void s3_create_needle(AnalogGauge* g, lv_point_precise_t* pts, int width, int center_size) {
+    g->needle_pts = pts;
+    g->needle_angle = -1;
+
+    // Zeiger
+    g->needle = lv_line_create(g->container);
+    lv_obj_set_style_line_width(g->needle, width, 0);
+    lv_obj_set_style_line_color(g->needle, COLOR_NEEDLE, 0);
+    lv_obj_set_style_line_rounded(g->needle, true, 0);
+    s3_set_needle(g, 0);
+
+    // Zeiger Mittelpunkt
+    g->needle_center = lv_obj_create(g->container);
+    lv_obj_remove_style_all(g->needle_center);
+    lv_obj_set_size(g->needle_center, center_size, center_size);
+    lv_obj_set_pos(g->needle_center, g->cx - center_size / 2, g->cy - center_size / 2);
+    lv_obj_set_style_radius(g->needle_center, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_bg_color(g->needle_center, COLOR_NEEDLE, 0);
+    lv_obj_set_style_bg_opa(g->needle_center, LV_OPA_COVER, 0);
 }
 
 // ------------------------------------------------------------
@@ -1197,7 +1704,7 @@ static void s3_create_small_gauge(lv_obj_t* parent, AnalogGauge* g, int x, int y
     lv_arc_set_rotation(g->arc_fill, 180);
     lv_arc_set_bg_angles(g->arc_fill, 0, 180);
     lv_arc_set_range(g->arc_fill, 0, 100);
-    lv_arc_set_value(g->arc_fill, 50);
+    lv_arc_set_value(g->arc_fill, 0);
     lv_obj_remove_style(g->arc_fill, NULL, LV_PART_KNOB);
     lv_obj_clear_flag(g->arc_fill, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_set_style_arc_width(g->arc_fill, 0, LV_PART_MAIN);
@@ -1232,25 +1739,7 @@ static void s3_create_small_gauge(lv_obj_t* parent, AnalogGauge* g, int x, int y
         lv_line_set_points(g->tick_lines[i], g->tick_points[i], 2);
     }
 
-    // Zeiger
-    g->needle = lv_line_create(g->container);
-    lv_obj_set_style_line_width(g->needle, 2, 0);
-    lv_obj_set_style_line_color(g->needle, COLOR_NEEDLE, 0);
-    lv_obj_set_style_line_rounded(g->needle, true, 0);
-    pts[0].x = g->cx;
-    pts[0].y = g->cy;
-    pts[1].x = g->cx - g->needle_len;
-    pts[1].y = g->cy;
-    lv_line_set_points(g->needle, pts, 2);
-
-    // Zeiger Mittelpunkt
-    g->needle_center = lv_obj_create(g->container);
-    lv_obj_remove_style_all(g->needle_center);
-    lv_obj_set_size(g->needle_center, 10, 10);
-    lv_obj_set_pos(g->needle_center, g->cx - 5, g->cy - 5);
-    lv_obj_set_style_radius(g->needle_center, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_bg_color(g->needle_center, COLOR_NEEDLE, 0);
-    lv_obj_set_style_bg_opa(g->needle_center, LV_OPA_COVER, 0);
+    s3_create_needle(g, pts, 2, 10);
 
     // Wert Label (Playfair 20 mit ° Symbol)
     g->value_label = lv_label_create(g->container);
@@ -1317,7 +1806,7 @@ static void s3_create_big_gauge(lv_obj_t* parent, AnalogGauge* g, int x, int y,
     lv_arc_set_rotation(g->arc_fill, 180);
     lv_arc_set_bg_angles(g->arc_fill, 0, 180);
     lv_arc_set_range(g->arc_fill, 0, 100);
-    lv_arc_set_value(g->arc_fill, 50);
+    lv_arc_set_value(g->arc_fill, 0);
     lv_obj_remove_style(g->arc_fill, NULL, LV_PART_KNOB);
     lv_obj_clear_flag(g->arc_fill, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_set_style_arc_width(g->arc_fill, 0, LV_PART_MAIN);
@@ -1352,25 +1841,7 @@ static void s3_create_big_gauge(lv_obj_t* parent, AnalogGauge* g, int x, int y,
         lv_line_set_points(g->tick_lines[i], g->tick_points[i], 2);
     }
 
-    // Zeiger
-    g->needle = lv_line_create(g->container);
-    lv_obj_set_style_line_width(g->needle, 3, 0);
-    lv_obj_set_style_line_color(g->needle, COLOR_NEEDLE, 0);
-    lv_obj_set_style_line_rounded(g->needle, true, 0);
-    pts[0].x = g->cx;
-    pts[0].y = g->cy;
-    pts[1].x = g->cx - g->needle_len;
-    pts[1].y = g->cy;
-    lv_line_set_points(g->needle, pts, 2);
-
-    // Zeiger Mittelpunkt
-    g->needle_center = lv_obj_create(g->container);
-    lv_obj_remove_style_all(g->needle_center);
-    lv_obj_set_size(g->needle_center, 16, 16);
-    lv_obj_set_pos(g->needle_center, g->cx - 8, g->cy - 8);
-    lv_obj_set_style_radius(g->needle_center, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_bg_color(g->needle_center, COLOR_NEEDLE, 0);
-    lv_obj_set_style_bg_opa(g->needle_center, LV_OPA_COVER, 0);
+    s3_create_needle(g, pts, 3, 16);
 
     // Value label (Playfair 32 for large values)
     g->value_label = lv_label_create(g->container);
@@ -1391,6 +1862,63 @@ static void s3_create_big_gauge(lv_obj_t* parent, AnalogGauge* g, int x, int y,
     lv_label_set_text(g->name_label, name);
 }
 
+// ------------------------------------------------------------
+// Statisches Zifferblatt zu einem Bild zusammenfassen
+// ------------------------------------------------------------
+static void s3_flatten_face(lv_obj_t* scr, lv_obj_t* main_cont) {
+    AnalogGauge* gauges[3] = {&s3_gauge_temp, &s3_gauge_co2, &s3_gauge_hum};
+
+    if (!ui_sprite_alloc(&s3_face_buf, 480, 320, LV_COLOR_FORMAT_RGB565)) {
+        Serial.println("[UI] Analog face not flattened (no PSRAM)");
+        return;
+    }
+    uint32_t t0 = micros();
+
+    // Everything that changes is hidden while the rest is captured
+    lv_obj_t* dynamic[2 + 3 * 4];
+    int n = 0;
+    dynamic[n++] = s3_lbl_time;
+    dynamic[n++] = s3_lbl_date;
+    for (int i = 0; i < 3; i++) {
+        dynamic[n++] = gauges[i]->arc_fill;
+        dynamic[n++] = gauges[i]->needle;
+        dynamic[n++] = gauges[i]->needle_center;
+        dynamic[n++] = gauges[i]->value_label;
+    }
+    for (int i = 0; i < n; i++) lv_obj_add_flag(dynamic[i], LV_OBJ_FLAG_HIDDEN);
+    lv_result_t res = lv_snapshot_take_to_draw_buf(scr, LV_COLOR_FORMAT_RGB565, &s3_face_buf);
+    for (int i = 0; i < n; i++) lv_obj_remove_flag(dynamic[i], LV_OBJ_FLAG_HIDDEN);
+
+    if (res != LV_RESULT_OK) {
+        Serial.println("[UI] Analog face snapshot failed, keeping objects");
+        ui_sprite_free(&s3_face_buf);
+        return;
+    }
+
+    // The image replaces the static objects
+    for (int i = 0; i < 3; i++) {
+        AnalogGauge* g = gauges[i];
+        lv_obj_delete(g->arc_bg);
+        g->arc_bg = nullptr;
+        for (int t = 0; t < g->tick_count; t++) {
+            lv_obj_delete(g->tick_lines[t]);
+            g->tick_lines[t] = nullptr;
+        }
+        lv_obj_delete(g->name_label);
+        g->name_label = nullptr;
+    }
+    lv_obj_delete(s3_lbl_brand);
+    s3_lbl_brand = nullptr;
+    lv_obj_set_style_border_width(main_cont, 0, 0);
+
+    lv_obj_t* face = lv_image_create(scr);
+    lv_image_set_src(face, &s3_face_buf);
+    lv_obj_set_pos(face, 0, 0);
+    lv_obj_move_to_index(face, 0);
+
+    Serial.printf("[UI] Analog face flattened in %lu us\n", (unsigned long)(micros() - t0));
+}
+
 // ------------------------------------------------------------
 // Analog Screen erstellen
 // ------------------------------------------------------------
@@ -1457,6 +1985,9 @@ static void create_screen3_analog() {
     s3_create_small_gauge(main_cont, &s3_gauge_hum, start_x + 100 + gap + 220 + gap, gauge_y_small,
                           0.0f, 100.0f, COLOR_HUM_GAUGE, "%", "Humidity", s3_needle_pts_hum);
 
+    // Only needles, arcs and labels are redrawn from now on
+    s3_flatten_face(scr, main_cont);
+
     Serial.println("[UI] Screen 3 (analog cockpit) created");
 }
 
@@ -1478,15 +2009,15 @@ static void update_screen3_time() {
 static void update_screen3_sensors() {
     // Temperatur
     s3_gauge_temp.current_value = cached_temp;
-    s3_update_gauge(&s3_gauge_temp, s3_needle_pts_temp);
+    s3_update_gauge(&s3_gauge_temp);
     
     // CO2
     s3_gauge_co2.current_value = (float)cached_co2;
-    s3_update_gauge(&s3_gauge_co2, s3_needle_pts_co2);
+    s3_update_gauge(&s3_gauge_co2);
     
     // Feuchtigkeit
     s3_gauge_hum.current_value = cached_hum;
-    s3_update_gauge(&s3_gauge_hum, s3_needle_pts_hum);
+    s3_update_gauge(&s3_gauge_hum);
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
@@ -1494,47 +2025,19 @@ static void update_screen3_sensors() {
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static void update_screen1_time() {
-    if (!s1_lbl_time) return;
-    
-    char buf[8];
-    snprintf(buf, sizeof(buf), "%02d:%02d", cached_hour, cached_min);
-    lv_label_set_text(s1_lbl_time, buf);
-    
-    if (s1_lbl_seconds) {
-        char sec_buf[4];
-        snprintf(sec_buf, sizeof(sec_buf), "%02d", cached_sec);
-        lv_label_set_text(s1_lbl_seconds, sec_buf);
-        
-        lv_obj_update_layout(s1_lbl_time);
-        int time_x = lv_obj_get_x(s1_lbl_time);
-        int time_w = lv_obj_get_width(s1_lbl_time);
-        lv_obj_set_pos(s1_lbl_seconds, time_x + time_w + 3, 65);
-    }
+    clock_set(&s1_clock, cached_hour, cached_min, cached_sec);
     
-    if (s1_lbl_date) {
+    // Date changes once a day
+    if (s1_lbl_date && strcmp(lv_label_get_text(s1_lbl_date), cached_date) != 0) {
         lv_label_set_text(s1_lbl_date, cached_date);
     }
 }
 
 static void update_screen2_time() {
-    if (!s2_lbl_time) return;
-    
-    char buf[8];
-    snprintf(buf, sizeof(buf), "%02d:%02d", cached_hour, cached_min);
-    lv_label_set_text(s2_lbl_time, buf);
+    clock_set(&s2_clock, cached_hour, cached_min, cached_sec);
     
-    if (s2_lbl_seconds) {
-        char sec_buf[4];
-        snprintf(sec_buf, sizeof(sec_buf), "%02d", cached_sec);
-        lv_label_set_text(s2_lbl_seconds, sec_buf);
-        
-        lv_obj_update_layout(s2_lbl_time);
-        int time_x = lv_obj_get_x(s2_lbl_time);
-        int time_w = lv_obj_get_width(s2_lbl_time);
-        lv_obj_set_pos(s2_lbl_seconds, time_x + time_w + 3, 65);
-    }
-    
-    if (s2_lbl_date) {
+    // Date changes once a day
+    if (s2_lbl_date && strcmp(lv_label_get_text(s2_lbl_date), cached_date) != 0) {
         lv_label_set_text(s2_lbl_date, cached_date);
     }
 }
@@ -1543,38 +2046,20 @@ static void update_screen1_sensors() {
     if (!s1_lbl_temp_value) return;
     
     char buf[16];
-    Status air = get_air_quality(cached_co2, cached_pm25);
     
     // AQI aktualisieren
-    lv_color_t col = get_status_color(air);
-    lv_obj_set_style_arc_color(s1_arc_aqi, col, LV_PART_INDICATOR);
-    int arc_val = (air == GOOD) ? 100 : (air == WARN) ? 66 : 33;
-    lv_arc_set_value(s1_arc_aqi, arc_val);
-    lv_label_set_text(s1_lbl_aqi_status, get_status_text(air));
-    lv_obj_set_style_text_color(s1_lbl_aqi_status, col, 0);
-    lv_image_set_src(s1_img_emoji, get_status_emoji_img(air));
+    view_set_aqi(&s1_views[VIEW_AQI], s1_arc_aqi, s1_lbl_aqi_status, s1_img_emoji,
+                 air_status());
     
     // Temperatur
     snprintf(buf, sizeof(buf), "%.1f", cached_temp);
-    lv_label_set_text(s1_lbl_temp_value, buf);
-    lv_obj_update_layout(s1_lbl_temp_value);
-    lv_obj_set_pos(s1_lbl_temp_unit, lv_obj_get_x(s1_lbl_temp_value) + lv_obj_get_width(s1_lbl_temp_value) + 3, 48);
-    
-    Status temp_status = get_temp_status(cached_temp);
-    lv_obj_remove_style(s1_bar_temp, NULL, LV_PART_INDICATOR);
-    lv_obj_add_style(s1_bar_temp, get_bar_style(temp_status), LV_PART_INDICATOR);
-    lv_bar_set_value(s1_bar_temp, (temp_status == GOOD) ? 33 : (temp_status == WARN) ? 66 : 100, LV_ANIM_ON);
+    view_set_value(&s1_views[VIEW_TEMP], s1_lbl_temp_value, s1_lbl_temp_unit, 48, buf);
+    view_set_bar(&s1_views[VIEW_TEMP], s1_bar_temp, channel_status(AQI_TEMP));
     
     // Feuchte
     snprintf(buf, sizeof(buf), "%d", (int)cached_hum);
-    lv_label_set_text(s1_lbl_hum_value, buf);
-    lv_obj_update_layout(s1_lbl_hum_value);
-    lv_obj_set_pos(s1_lbl_hum_unit, lv_obj_get_x(s1_lbl_hum_value) + lv_obj_get_width(s1_lbl_hum_value) + 3, 48);
-    
-    Status hum_status = get_hum_status(cached_hum);
-    lv_obj_remove_style(s1_bar_hum, NULL, LV_PART_INDICATOR);
-    lv_obj_add_style(s1_bar_hum, get_bar_style(hum_status), LV_PART_INDICATOR);
-    lv_bar_set_value(s1_bar_hum, (hum_status == GOOD) ? 33 : (hum_status == WARN) ? 66 : 100, LV_ANIM_ON);
+    view_set_value(&s1_views[VIEW_HUM], s1_lbl_hum_value, s1_lbl_hum_unit, 48, buf);
+    view_set_bar(&s1_views[VIEW_HUM], s1_bar_hum, channel_status(AQI_HUM));
 }
 
 static void update_screen2_sensors() {
@@ -1584,53 +2069,32 @@ static void update_screen2_sensors() {
     
     // Temperatur
     snprintf(buf, sizeof(buf), "%.1f", cached_temp);
-    lv_label_set_text(s2_lbl_temp_value, buf);
-    lv_obj_update_layout(s2_lbl_temp_value);
-    lv_obj_set_pos(s2_lbl_temp_unit, lv_obj_get_x(s2_lbl_temp_value) + lv_obj_get_width(s2_lbl_temp_value) + 3, 34);
-    
-    Status temp_status = get_temp_status(cached_temp);
-    lv_obj_remove_style(s2_bar_temp, NULL, LV_PART_INDICATOR);
-    lv_obj_add_style(s2_bar_temp, get_bar_style(temp_status), LV_PART_INDICATOR);
-    lv_bar_set_value(s2_bar_temp, (temp_status == GOOD) ? 33 : (temp_status == WARN) ? 66 : 100, LV_ANIM_ON);
+    view_set_value(&s2_views[VIEW_TEMP], s2_lbl_temp_value, s2_lbl_temp_unit, 34, buf);
+    view_set_bar(&s2_views[VIEW_TEMP], s2_bar_temp, channel_status(AQI_TEMP));
     
     // Feuchte
     snprintf(buf, sizeof(buf), "%d", (int)cached_hum);
-    lv_label_set_text(s2_lbl_hum_value, buf);
-    lv_obj_update_layout(s2_lbl_hum_value);
-    lv_obj_set_pos(s2_lbl_hum_unit, lv_obj_get_x(s2_lbl_hum_value) + lv_obj_get_width(s2_lbl_hum_value) + 3, 96);
-    
-    Status hum_status = get_hum_status(cached_hum);
-    lv_obj_remove_style(s2_bar_hum, NULL, LV_PART_INDICATOR);
-    lv_obj_add_style(s2_bar_hum, get_bar_style(hum_status), LV_PART_INDICATOR);
-    lv_bar_set_value(s2_bar_hum, (hum_status == GOOD) ? 33 : (hum_status == WARN) ? 66 : 100, LV_ANIM_ON);
+    view_set_value(&s2_views[VIEW_HUM], s2_lbl_hum_value, s2_lbl_hum_unit, 96, buf);
+    view_set_bar(&s2_views[VIEW_HUM], s2_bar_hum, channel_status(AQI_HUM));
     
     // CO2, PM2.5, VOC
     Status statuses[3] = {
-        get_co2_status(cached_co2),
-        get_pm25_status(cached_pm25),
-        get_voc_status(cached_voc)
+        channel_status(AQI_CO2),
+        channel_status(AQI_PM25),
+        channel_status(AQI_VOC)
     };
     int values[3] = {cached_co2, cached_pm25, cached_voc};
     
     for (int i = 0; i < 3; i++) {
+        Retained* view = &s2_views[VIEW_CO2 + i];
         snprintf(buf, sizeof(buf), "%d", values[i]);
-        lv_label_set_text(s2_cards[i].value, buf);
-        lv_obj_update_layout(s2_cards[i].value);
-        lv_obj_set_pos(s2_cards[i].unit, lv_obj_get_x(s2_cards[i].value) + lv_obj_get_width(s2_cards[i].value) + 3, 48);
-        
-        lv_obj_remove_style(s2_cards[i].bar, NULL, LV_PART_INDICATOR);
-        lv_obj_add_style(s2_cards[i].bar, get_bar_style(statuses[i]), LV_PART_INDICATOR);
-        lv_bar_set_value(s2_cards[i].bar, (statuses[i] == GOOD) ? 33 : (statuses[i] == WARN) ? 66 : 100, LV_ANIM_ON);
+        view_set_value(view, s2_cards[i].value, s2_cards[i].unit, 48, buf);
+        view_set_bar(view, s2_cards[i].bar, statuses[i]);
     }
     
     // AQI
-    Status air = get_air_quality(cached_co2, cached_pm25);
-    lv_color_t col = get_status_color(air);
-    lv_obj_set_style_arc_color(s2_arc_aqi, col, LV_PART_INDICATOR);
-    lv_arc_set_value(s2_arc_aqi, (air == GOOD) ? 100 : (air == WARN) ? 66 : 33);
-    lv_label_set_text(s2_lbl_aqi_status, get_status_text(air));
-    lv_obj_set_style_text_color(s2_lbl_aqi_status, col, 0);
-    lv_image_set_src(s2_img_emoji, get_status_emoji_img(air));
+    view_set_aqi(&s2_views[VIEW_AQI], s2_arc_aqi, s2_lbl_aqi_status, s2_img_emoji,
+                 air_status());
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
@@ -1647,68 +2111,57 @@ static void update_screen2_sensors() {
 // Bubble Layout
 #define BUBBLE_MIN_SIZE  95
 #define BUBBLE_MAX_SIZE  130
+#define BUBBLE_SIZE_STEP 4     // Sizes are rounded so sprites can be reused
+
+// Bubble look: rendered once per size and status into a sprite, because the
+// 30 px shadow is one of the slowest things the SW renderer draws
+#define BUBBLE_BORDER_WIDTH    3
+#define BUBBLE_SHADOW_WIDTH    30
+#define BUBBLE_SHADOW_SPREAD   2
+#define BUBBLE_SPRITE_MARGIN   (BUBBLE_SHADOW_WIDTH / 2 + BUBBLE_SHADOW_SPREAD + 1)
+#define BUBBLE_SPRITE_SLOTS    8     // 5 visible + spares, LRU (max. ~120 KB PSRAM each)
 
 // Bubble Struktur
 struct Bubble {
-    lv_obj_t* container;
+    lv_obj_t* sprite;       // Pre-rendered circle + border + shadow
+    lv_obj_t* container;    // Transparent, only holds the labels
     lv_obj_t* lbl_value;
     lv_obj_t* lbl_unit;
     lv_obj_t* lbl_label;
     int center_x;
     int center_y;
-    int current_size;
+    int current_size;       // 0 = no sprite yet
+    Status status;
+};
+
+// Cached bubble sprite (ARGB8888, PSRAM)
+struct BubbleSprite {
+    lv_draw_buf_t buf;
+    int16_t size;           // 0 = empty slot
+    Status status;
+    uint32_t last_used;
 };
 
 // Screen 4 Elemente
 static lv_obj_t* s4_lbl_time = nullptr;
 static lv_obj_t* s4_lbl_date = nullptr;
 static Bubble s4_bubbles[5];
-static lv_style_t style_bubble_base;
-static bool style_bubble_initialized = false;
-
-// Calculate bubble size based on value
-static int s4_get_bubble_size(int type, float value) {
-    float min_val, max_val, good_min, good_max;
-
-    switch(type) {
-        case 0: // Temperatur
-            min_val = 10; max_val = 35; good_min = 18; good_max = 26;
-            break;
-        case 1: // Feuchte
-            min_val = 20; max_val = 80; good_min = 30; good_max = 60;
-            break;
-        case 2: // CO2
-            min_val = 400; max_val = 2000; good_min = 0; good_max = 800;
-            break;
-        case 3: // PM2.5
-            min_val = 0; max_val = 50; good_min = 0; good_max = 15;
-            break;
-        case 4: // VOC
-            min_val = 0; max_val = 1000; good_min = 0; good_max = 250;
-            break;
-        default:
-            return BUBBLE_MIN_SIZE;
-    }
+static BubbleSprite s4_sprites[BUBBLE_SPRITE_SLOTS];
+static lv_draw_buf_t s4_bg_buf;          // Flattened gradient + stars (RGB565)
+static uint32_t s4_sprite_renders = 0;
+static uint32_t s4_sprite_hits = 0;
 
-    if (value < min_val) value = min_val;
-    if (value > max_val) value = max_val;
+// Sensor channel per bubble
+static const AqiChannel S4_BUBBLE_CHANNELS[5] = { AQI_TEMP, AQI_HUM, AQI_CO2, AQI_PM25, AQI_VOC };
 
-    float severity = 0.0f;
-
-    // Severity only outside of good range
-    if (value < good_min) {
-        severity = (good_min - value) / (good_min - min_val);
-    } else if (value > good_max) {
-        severity = (value - good_max) / (max_val - good_max);
-    }
-    // Values in good range → severity = 0 (small green bubble)
-
-    if (severity < 0.0f) severity = 0.0f;
-    if (severity > 1.0f) severity = 1.0f;
+// Bubble size from the severity of the cached classification
+// (good range → small bubble, grows towards "very poor")
+static int s4_get_bubble_size(int idx) {
+    float severity = cached_aqi.severity[S4_BUBBLE_CHANNELS[idx]];
 
     // Size offset per sensor type (+ larger, - smaller)
     int size_offset = 0;
-    switch(type) {
+    switch(idx) {
         case 1: size_offset = -8; break;  // Humidity: smaller
         case 3: size_offset = 8; break;   // PM2.5: larger
         case 4: size_offset = -8; break;  // VOC: smaller
@@ -1717,54 +2170,149 @@ static int s4_get_bubble_size(int type, float value) {
     return (int)(BUBBLE_MIN_SIZE + severity * (BUBBLE_MAX_SIZE - BUBBLE_MIN_SIZE)) + size_offset;
 }
 
-// Calculate bubble status (for color)
-static Status s4_get_bubble_status(int type, float value) {
-    switch(type) {
-        case 0: return get_temp_status(value);
-        case 1: return get_hum_status(value);
-        case 2: return get_co2_status((int)value);
-        case 3: return get_pm25_status((int)value);
-        case 4: return get_voc_status((int)value);
-        default: return GOOD;
+// Renders into a sprite buffer through a temporary, hidden canvas
+static lv_obj_t* s4_canvas_begin(lv_draw_buf_t* buf, lv_layer_t* layer) {
+    lv_obj_t* canvas = lv_canvas_create(screens[UI_SCREEN_BUBBLE]);
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_draw_buf(canvas, buf);
+    lv_canvas_init_layer(canvas, layer);
+    return canvas;
+}
+
+static void s4_canvas_end(lv_obj_t* canvas, lv_layer_t* layer) {
+    lv_canvas_finish_layer(canvas, layer);
+    lv_obj_delete(canvas);
+}
+
+static bool s4_sprite_in_use(const lv_draw_buf_t* buf) {
+    for (int i = 0; i < 5; i++) {
+        if (s4_bubbles[i].sprite && lv_image_get_src(s4_bubbles[i].sprite) == buf) return true;
+    }
+    return false;
+}
+
+static void s4_free_sprites() {
+    for (int i = 0; i < BUBBLE_SPRITE_SLOTS; i++) {
+        ui_sprite_free(&s4_sprites[i].buf);
+        s4_sprites[i].size = 0;
+    }
+    ui_sprite_free(&s4_bg_buf);
+}
+
+/**
+ * Returns the sprite for a bubble size and status, rendering it on first use
+ * (the least recently used sprite that no bubble shows is replaced)
+ */
+static const lv_draw_buf_t* s4_bubble_sprite(int size, Status status) {
+    BubbleSprite* slot = nullptr;
+    for (int i = 0; i < BUBBLE_SPRITE_SLOTS; i++) {
+        if (s4_sprites[i].size == size && s4_sprites[i].status == status) {
+            s4_sprites[i].last_used = lv_tick_get();
+            s4_sprite_hits++;
+            return &s4_sprites[i].buf;
+        }
+    }
+    for (int i = 0; i < BUBBLE_SPRITE_SLOTS; i++) {
+        BubbleSprite* s = &s4_sprites[i];
+        if (s->size == 0) {
+            slot = s;
+            break;
+        }
+        if (s4_sprite_in_use(&s->buf)) continue;
+        if (!slot || s->last_used < slot->last_used) slot = s;
+    }
+    if (!slot) return nullptr;
+
+    ui_sprite_free(&slot->buf);
+    slot->size = 0;
+
+    const int dim = size + 2 * BUBBLE_SPRITE_MARGIN;
+    if (!ui_sprite_alloc(&slot->buf, dim, dim, LV_COLOR_FORMAT_ARGB8888)) return nullptr;
+
+    uint32_t t0 = micros();
+    lv_color_t color = get_status_color(status);
+
+    lv_layer_t layer;
+    lv_obj_t* canvas = s4_canvas_begin(&slot->buf, &layer);
+
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.radius = LV_RADIUS_CIRCLE;
+    rect.bg_color = color;
+    rect.bg_opa = LV_OPA_20;
+    rect.border_color = color;
+    rect.border_width = BUBBLE_BORDER_WIDTH;
+    rect.border_opa = LV_OPA_COVER;
+    rect.shadow_color = color;
+    rect.shadow_width = BUBBLE_SHADOW_WIDTH;
+    rect.shadow_spread = BUBBLE_SHADOW_SPREAD;
+    rect.shadow_opa = LV_OPA_40;
+
+    lv_area_t area;
+    area.x1 = BUBBLE_SPRITE_MARGIN;
+    area.y1 = BUBBLE_SPRITE_MARGIN;
+    area.x2 = area.x1 + size - 1;
+    area.y2 = area.y1 + size - 1;
+    lv_draw_rect(&layer, &rect, &area);
+
+    s4_canvas_end(canvas, &layer);
+
+    slot->size = size;
+    slot->status = status;
+    slot->last_used = lv_tick_get();
+    s4_sprite_renders++;
+
+    Serial.printf("[UI] Bubble sprite %dpx/%d rendered in %lu us (renders: %lu, hits: %lu)\n",
+                  size, status, (unsigned long)(micros() - t0),
+                  (unsigned long)s4_sprite_renders, (unsigned long)s4_sprite_hits);
+    return &slot->buf;
+}
+
+static int s4_round_size(int size) {
+    return (size + BUBBLE_SIZE_STEP / 2) / BUBBLE_SIZE_STEP * BUBBLE_SIZE_STEP;
+}
+
+// Größe/Farbe eines Bubbles setzen (nur Sprite tauschen, kein Restyling)
+static void s4_set_bubble_look(Bubble* b, int size, Status status) {
+    if (size == b->current_size && status == b->status) return;
+
+    const lv_draw_buf_t* sprite = s4_bubble_sprite(size, status);
+    if (!sprite) {
+        Serial.println("[UI] ERROR: Bubble sprite could not be created");
+        return;
     }
+    lv_image_set_src(b->sprite, sprite);
+    lv_obj_set_pos(b->sprite, b->center_x - (int)sprite->header.w / 2,
+                   b->center_y - (int)sprite->header.h / 2);
+
+    // Position neu berechnen (Mittelpunkt bleibt gleich)
+    lv_obj_set_size(b->container, size, size);
+    lv_obj_set_pos(b->container, b->center_x - size / 2, b->center_y - size / 2);
+    lv_obj_set_style_text_color(b->lbl_value, get_status_color(status), 0);
+
+    b->current_size = size;
+    b->status = status;
 }
 
 // Einzelnen Bubble aktualisieren
 static void s4_update_bubble(int idx, float value) {
     if (!s4_bubbles[idx].container) return;
     
-    Status status = s4_get_bubble_status(idx, value);
-    int new_size = s4_get_bubble_size(idx, value);
-
-    // Position neu berechnen (Mittelpunkt bleibt gleich)
-    int x = s4_bubbles[idx].center_x - new_size / 2;
-    int y = s4_bubbles[idx].center_y - new_size / 2;
+    Status status = channel_status(S4_BUBBLE_CHANNELS[idx]);
+    int new_size = s4_round_size(s4_get_bubble_size(idx));
 
-    lv_obj_set_size(s4_bubbles[idx].container, new_size, new_size);
-    lv_obj_set_pos(s4_bubbles[idx].container, x, y);
+    s4_set_bubble_look(&s4_bubbles[idx], new_size, status);
 
-    // Farbe basierend auf Status
-    lv_color_t status_color = get_status_color(status);
-    lv_obj_set_style_bg_color(s4_bubbles[idx].container, status_color, 0);
-    lv_obj_set_style_border_color(s4_bubbles[idx].container, status_color, 0);
-    lv_obj_set_style_shadow_color(s4_bubbles[idx].container, status_color, 0);
-
-    // Wert aktualisieren
+    // Wert aktualisieren (nur bei Änderung neu zeichnen)
     char buf[16];
     if (idx == 0) {
         snprintf(buf, sizeof(buf), "%.1f", value);
     } else {
         snprintf(buf, sizeof(buf), "%d", (int)value);
     }
-    lv_label_set_text(s4_bubbles[idx].lbl_value, buf);
-    lv_obj_set_style_text_color(s4_bubbles[idx].lbl_value, status_color, 0);
-
-    // Elemente neu zentrieren
-    lv_obj_align(s4_bubbles[idx].lbl_value, LV_ALIGN_CENTER, 0, -8);
-    lv_obj_align(s4_bubbles[idx].lbl_unit, LV_ALIGN_CENTER, 0, 12);
-    lv_obj_align(s4_bubbles[idx].lbl_label, LV_ALIGN_CENTER, 0, 28);
-
-    s4_bubbles[idx].current_size = new_size;
+    if (strcmp(lv_label_get_text(s4_bubbles[idx].lbl_value), buf) != 0) {
+        lv_label_set_text(s4_bubbles[idx].lbl_value, buf);
+    }
 }
 
 // Sterne-Positionen (statisch)
@@ -1775,8 +2323,64 @@ static const struct { int x; int y; int size; int opa; } s4_star_data[11] = {
     {300, 145, 2, 150}, {240, 260, 2, 160},
 };
 
+/**
+ * Renders gradient and stars once into a full-screen RGB565 image, so
+ * invalidated areas (e.g. the clock every second) are a plain copy instead
+ * of re-rasterizing the gradient
+ */
+static bool s4_render_background() {
+    if (!ui_sprite_alloc(&s4_bg_buf, 480, 320, LV_COLOR_FORMAT_RGB565)) return false;
+
+    uint32_t t0 = micros();
+    lv_layer_t layer;
+    lv_obj_t* canvas = s4_canvas_begin(&s4_bg_buf, &layer);
+
+    // Gradient Hintergrund
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.bg_opa = LV_OPA_COVER;
+    rect.bg_color = COLOR_BUBBLE_BG_DARK;
+    rect.bg_grad.dir = LV_GRAD_DIR_VER;
+    rect.bg_grad.stops_count = 2;
+    rect.bg_grad.stops[0].color = COLOR_BUBBLE_BG_DARK;
+    rect.bg_grad.stops[0].opa = LV_OPA_COVER;
+    rect.bg_grad.stops[0].frac = 0;
+    rect.bg_grad.stops[1].color = COLOR_BUBBLE_BG_LIGHT;
+    rect.bg_grad.stops[1].opa = LV_OPA_COVER;
+    rect.bg_grad.stops[1].frac = 255;
+    lv_area_t area = {0, 0, 479, 319};
+    lv_draw_rect(&layer, &rect, &area);
+
+    // Sterne
+    for (int i = 0; i < 11; i++) {
+        lv_draw_rect_dsc_t star;
+        lv_draw_rect_dsc_init(&star);
+        star.radius = LV_RADIUS_CIRCLE;
+        star.bg_color = COLOR_BUBBLE_STAR;
+        star.bg_opa = s4_star_data[i].opa;
+        area.x1 = s4_star_data[i].x;
+        area.y1 = s4_star_data[i].y;
+        area.x2 = area.x1 + s4_star_data[i].size - 1;
+        area.y2 = area.y1 + s4_star_data[i].size - 1;
+        lv_draw_rect(&layer, &star, &area);
+    }
+
+    s4_canvas_end(canvas, &layer);
+    Serial.printf("[UI] Bubble background flattened in %lu us\n", (unsigned long)(micros() - t0));
+    return true;
+}
+
 // Hintergrund mit Gradient und Sternen erstellen
 static void s4_create_background(lv_obj_t* parent) {
+    if (s4_render_background()) {
+        lv_obj_t* bg = lv_image_create(parent);
+        lv_image_set_src(bg, &s4_bg_buf);
+        lv_obj_set_pos(bg, 0, 0);
+        lv_obj_move_to_index(bg, 0);
+        return;
+    }
+
+    // Fallback ohne PSRAM: Gradient und Sterne als Objekte
     // Gradient Hintergrund
     lv_obj_t* bg = lv_obj_create(parent);
     lv_obj_remove_style_all(bg);
@@ -1836,19 +2440,6 @@ static void create_screen4_bubble() {
     screens[UI_SCREEN_BUBBLE] = lv_obj_create(NULL);
     lv_obj_t* scr = screens[UI_SCREEN_BUBBLE];
 
-    // Bubble Style initialisieren
-    if (!style_bubble_initialized) {
-        style_bubble_initialized = true;
-        lv_style_init(&style_bubble_base);
-        lv_style_set_bg_opa(&style_bubble_base, LV_OPA_20);
-        lv_style_set_radius(&style_bubble_base, LV_RADIUS_CIRCLE);
-        lv_style_set_border_width(&style_bubble_base, 3);
-        lv_style_set_border_opa(&style_bubble_base, LV_OPA_COVER);
-        lv_style_set_shadow_width(&style_bubble_base, 30);
-        lv_style_set_shadow_opa(&style_bubble_base, LV_OPA_40);
-        lv_style_set_shadow_spread(&style_bubble_base, 2);
-    }
-
     s4_create_background(scr);
 
     // Uhrzeit (oben mittig, Orbitron Space-Font)
@@ -1879,21 +2470,14 @@ static void create_screen4_bubble() {
     for (int i = 0; i < 5; i++) {
         s4_bubbles[i].center_x = center_x[i];
         s4_bubbles[i].center_y = center_y[i];
-        s4_bubbles[i].current_size = BUBBLE_MIN_SIZE;
+        s4_bubbles[i].current_size = 0;
 
-        int initial_size = BUBBLE_MIN_SIZE;
-        int x = center_x[i] - initial_size / 2;
-        int y = center_y[i] - initial_size / 2;
+        // Kreis (Sprite, unter den Labels)
+        s4_bubbles[i].sprite = lv_image_create(scr);
 
-        // Kreis-Container
+        // Label-Container (transparent)
         s4_bubbles[i].container = lv_obj_create(scr);
         lv_obj_remove_style_all(s4_bubbles[i].container);
-        lv_obj_set_size(s4_bubbles[i].container, initial_size, initial_size);
-        lv_obj_set_pos(s4_bubbles[i].container, x, y);
-        lv_obj_add_style(s4_bubbles[i].container, &style_bubble_base, 0);
-        lv_obj_set_style_bg_color(s4_bubbles[i].container, COLOR_GOOD, 0);
-        lv_obj_set_style_border_color(s4_bubbles[i].container, COLOR_GOOD, 0);
-        lv_obj_set_style_shadow_color(s4_bubbles[i].container, COLOR_GOOD, 0);
         lv_obj_clear_flag(s4_bubbles[i].container, LV_OBJ_FLAG_SCROLLABLE);
         lv_obj_set_style_pad_all(s4_bubbles[i].container, 0, 0);
 
@@ -1902,21 +2486,25 @@ static void create_screen4_bubble() {
         lv_obj_set_style_text_font(s4_bubbles[i].lbl_value, FONT_28, 0);
         lv_obj_set_style_text_color(s4_bubbles[i].lbl_value, COLOR_GOOD, 0);
         lv_label_set_text(s4_bubbles[i].lbl_value, "--");
-        lv_obj_center(s4_bubbles[i].lbl_value);
 
         // Einheit Label
         s4_bubbles[i].lbl_unit = lv_label_create(s4_bubbles[i].container);
         lv_obj_set_style_text_font(s4_bubbles[i].lbl_unit, FONT_12, 0);
         lv_obj_set_style_text_color(s4_bubbles[i].lbl_unit, COLOR_BUBBLE_TEXT_DIM, 0);
         lv_label_set_text(s4_bubbles[i].lbl_unit, units[i]);
-        lv_obj_align_to(s4_bubbles[i].lbl_unit, s4_bubbles[i].lbl_value, LV_ALIGN_OUT_BOTTOM_MID, 0, -2);
 
         // Beschriftung
         s4_bubbles[i].lbl_label = lv_label_create(s4_bubbles[i].container);
         lv_obj_set_style_text_font(s4_bubbles[i].lbl_label, FONT_12, 0);
         lv_obj_set_style_text_color(s4_bubbles[i].lbl_label, COLOR_BUBBLE_TEXT_DIMMER, 0);
         lv_label_set_text(s4_bubbles[i].lbl_label, labels[i]);
-        lv_obj_align_to(s4_bubbles[i].lbl_label, s4_bubbles[i].lbl_unit, LV_ALIGN_OUT_BOTTOM_MID, 0, 2);
+
+        // Zentriert im Container, folgt dessen Größe
+        lv_obj_align(s4_bubbles[i].lbl_value, LV_ALIGN_CENTER, 0, -8);
+        lv_obj_align(s4_bubbles[i].lbl_unit, LV_ALIGN_CENTER, 0, 12);
+        lv_obj_align(s4_bubbles[i].lbl_label, LV_ALIGN_CENTER, 0, 28);
+
+        s4_set_bubble_look(&s4_bubbles[i], s4_round_size(BUBBLE_MIN_SIZE), GOOD);
     }
 
     // No legend - bubbles are self-explanatory
@@ -1947,149 +2535,949 @@ static void update_screen4_sensors() {
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * PUBLIC API FUNCTIONS
+ * SCREEN 5: HISTORY (Verlauf 1h / 24h / 7d)
+ * ═══════════════════════════════════════════════════════════════════════════
+ * Layout:
+ *   ┌──────────────────────────────────────────────┐
+ *   │ Verlauf                      1 h  24 h  7 d  │
+ *   │ ┌CO2───┬───────────── chart ──────────────┐  │
+ *   │ ├PM2.5─┼───────────── chart ──────────────┤  │
+ *   │ └Temp──┴───────────── chart ──────────────┘  │
+ *   └──────────────────────────────────────────────┘
+ *
+ * Every range keeps its own incremental LTTB decimation of the per-minute
+ * history (see lttb_decimator.h), one point per chart pixel column. The
+ * rings are the charts' external arrays: a new point is one ring write
+ * plus a new start index, nothing is re-decimated or copied. The rings
+ * live outside the screen, so the charts are complete when it is rebuilt.
+ * The button steps through the ranges before it leaves the screen.
+ */
+#define HIST_CHART_W    400     // Chart width in px = max. points per range
+#define HIST_CHANNELS   3       // CO2, PM2.5, temperature
+
+enum HistRange { HIST_RANGE_1H = 0, HIST_RANGE_24H, HIST_RANGE_7D, HIST_RANGE_COUNT };
+
+struct HistRangeDef {
+    const char* label;
+    uint32_t bucket_s;          // Seconds per chart point
+    int points;
+};
+
+static const HistRangeDef HIST_RANGES[HIST_RANGE_COUNT] = {
+    { "1 h",  60,   60           },     // Every minute as is
+    { "24 h", 216,  HIST_CHART_W },     // 86400 s / 400
+    { "7 d",  1512, HIST_CHART_W },     // 604800 s / 400
+};
+
+struct HistChannelDef {
+    const char* title;
+    const char* unit;
+    int32_t scale;              // Chart value = value * scale
+    int32_t min_span;           // Smallest y range (chart units)
+    uint32_t color;
+};
+
+static const HistChannelDef HIST_CHANNEL_DEFS[HIST_CHANNELS] = {
+    { "CO2",   "ppm",         1,  100, 0x3B82F6 },
+    { "PM2.5", TXT_UNIT_PM,   1,  10,  0x8B5CF6 },
+    { "Temp",  TXT_UNIT_TEMP, 10, 20,  0xF97316 },  // 0.1 °C steps
+};
+
+static LttbDecimator<HIST_CHANNELS> hist_decimators[HIST_RANGE_COUNT];
+static int32_t* hist_rings[HIST_RANGE_COUNT][HIST_CHANNELS] = {};
+static int32_t* hist_ring_mem = nullptr;
+
+struct HistCard {
+    lv_obj_t* chart;
+    lv_chart_series_t* series;
+    lv_obj_t* lbl_value;
+    lv_obj_t* lbl_max;
+    lv_obj_t* lbl_min;
+};
+
+static HistCard s5_cards[HIST_CHANNELS];
+static lv_obj_t* s5_lbl_ranges[HIST_RANGE_COUNT] = {nullptr, nullptr, nullptr};
+static HistRange s5_range = HIST_RANGE_1H;
+
+// Allocates the rings of all ranges in one block (PSRAM preferred)
+static bool hist_init() {
+    if (hist_ring_mem) return true;
+    
+    size_t total = 0;
+    for (int r = 0; r < HIST_RANGE_COUNT; r++) {
+        total += HIST_RANGES[r].points * HIST_CHANNELS;
+    }
+    hist_ring_mem = (int32_t*)heap_caps_malloc(total * sizeof(int32_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!hist_ring_mem) {
+        hist_ring_mem = (int32_t*)heap_caps_malloc(total * sizeof(int32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (!hist_ring_mem) {
+        Serial.println("[UI] ERROR: No memory for history charts");
+        return false;
+    }
+    
+    int32_t* p = hist_ring_mem;
+    for (int r = 0; r < HIST_RANGE_COUNT; r++) {
+        for (int ch = 0; ch < HIST_CHANNELS; ch++) {
+            hist_rings[r][ch] = p;
+            p += HIST_RANGES[r].points;
+        }
+        hist_decimators[r].begin(HIST_RANGES[r].bucket_s, HIST_RANGES[r].points, hist_rings[r]);
+    }
+    return true;
+}
+
+/**
+ * Feeds one per-minute value into all ranges
+ * @return true if the shown range got new points
+ */
+static bool hist_add(uint32_t timestamp, float temp, int co2, int pm25) {
+    if (!hist_init()) return false;
+    
+    const float values[HIST_CHANNELS] = {
+        (float)co2 * HIST_CHANNEL_DEFS[0].scale,
+        (float)pm25 * HIST_CHANNEL_DEFS[1].scale,
+        temp * HIST_CHANNEL_DEFS[2].scale
+    };
+    bool shown_changed = false;
+    for (int r = 0; r < HIST_RANGE_COUNT; r++) {
+        if (hist_decimators[r].add(timestamp, values) > 0 && r == s5_range) {
+            shown_changed = true;
+        }
+    }
+    return shown_changed;
+}
+
+static void s5_format(char* buf, size_t len, int ch, int32_t v) {
+    if (HIST_CHANNEL_DEFS[ch].scale == 10) {
+        snprintf(buf, len, "%.1f", v / 10.0f);
+    } else {
+        snprintf(buf, len, "%ld", (long)v);
+    }
+}
+
+// Points the charts at the current ring state (start index, y range, labels)
+static void update_screen5_history() {
+    if (!s5_cards[0].chart || !hist_ring_mem) return;
+    
+    const LttbDecimator<HIST_CHANNELS>& dec = hist_decimators[s5_range];
+    char buf[16];
+    
+    for (int ch = 0; ch < HIST_CHANNELS; ch++) {
+        HistCard* card = &s5_cards[ch];
+        const int32_t* ring = hist_rings[s5_range][ch];
+        
+        lv_chart_set_x_start_point(card->chart, card->series, dec.getHead());
+        
+        int32_t lo = LTTB_NO_VALUE, hi = 0;
+        bool any = false;
+        for (int i = 0; i < dec.getCapacity(); i++) {
+            if (ring[i] == LTTB_NO_VALUE) continue;
+            if (!any || ring[i] < lo) lo = ring[i];
+            if (!any || ring[i] > hi) hi = ring[i];
+            any = true;
+        }
+        
+        if (!any) {
+            lv_label_set_text(card->lbl_value, "--");
+            lv_label_set_text(card->lbl_max, "");
+            lv_label_set_text(card->lbl_min, "");
+            lv_chart_refresh(card->chart);
+            continue;
+        }
+        
+        // Newest kept point, min/max over the visible range
+        s5_format(buf, sizeof(buf), ch, ring[dec.getNewest()]);
+        lv_label_set_text(card->lbl_value, buf);
+        snprintf(buf, sizeof(buf), "max ");
+        s5_format(buf + 4, sizeof(buf) - 4, ch, hi);
+        lv_label_set_text(card->lbl_max, buf);
+        snprintf(buf, sizeof(buf), "min ");
+        s5_format(buf + 4, sizeof(buf) - 4, ch, lo);
+        lv_label_set_text(card->lbl_min, buf);
+        
+        // 10% headroom, flat lines still get a readable span
+        int32_t span = (hi - lo > HIST_CHANNEL_DEFS[ch].min_span) ? hi - lo : HIST_CHANNEL_DEFS[ch].min_span;
+        int32_t mid = lo + (hi - lo) / 2;
+        lo = mid - span * 6 / 10;
+        hi = mid + span * 6 / 10;
+        if (lo < 0 && HIST_CHANNEL_DEFS[ch].scale == 1) lo = 0;
+        lv_chart_set_range(card->chart, LV_CHART_AXIS_PRIMARY_Y, lo, hi);
+        lv_chart_refresh(card->chart);
+    }
+}
+
+static void s5_show_range(HistRange range) {
+    s5_range = range;
+    if (!s5_cards[0].chart || !hist_ring_mem) return;
+    
+    for (int r = 0; r < HIST_RANGE_COUNT; r++) {
+        lv_obj_set_style_text_color(s5_lbl_ranges[r], (r == range) ? COLOR_TEXT : COLOR_DATE, 0);
+    }
+    for (int ch = 0; ch < HIST_CHANNELS; ch++) {
+        // External arrays are never reallocated by the chart
+        lv_chart_set_ext_y_array(s5_cards[ch].chart, s5_cards[ch].series, hist_rings[range][ch]);
+        lv_chart_set_point_count(s5_cards[ch].chart, HIST_RANGES[range].points);
+    }
+    update_screen5_history();
+}
+
+static void create_screen5_history() {
+    screens[UI_SCREEN_HISTORY] = lv_obj_create(NULL);
+    lv_obj_t* scr = screens[UI_SCREEN_HISTORY];
+    lv_obj_set_style_bg_color(scr, COLOR_BG, 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    lv_obj_remove_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+    
+    const int CARD_X = 4;
+    const int CARD_Y = 40;
+    const int CARD_W = 472;
+    const int CARD_H = 88;
+    const int CARD_GAP = 5;
+    const int CARD_PAD = 8;
+    const int LEFT_W = CARD_W - 2 * CARD_PAD - HIST_CHART_W;
+    
+    lv_obj_t* title = lv_label_create(scr);
+    lv_obj_set_style_text_font(title, FONT_20, 0);
+    lv_obj_set_style_text_color(title, COLOR_TEXT, 0);
+    lv_label_set_text(title, "Verlauf");
+    lv_obj_set_pos(title, 12, 10);
+    
+    for (int r = 0; r < HIST_RANGE_COUNT; r++) {
+        s5_lbl_ranges[r] = lv_label_create(scr);
+        lv_obj_set_style_text_font(s5_lbl_ranges[r], FONT_16, 0);
+        lv_label_set_text(s5_lbl_ranges[r], HIST_RANGES[r].label);
+        lv_obj_set_pos(s5_lbl_ranges[r], 300 + r * 60, 12);
+    }
+    
+    for (int ch = 0; ch < HIST_CHANNELS; ch++) {
+        const HistChannelDef& def = HIST_CHANNEL_DEFS[ch];
+        HistCard* card = &s5_cards[ch];
+        
+        lv_obj_t* box = lv_obj_create(scr);
+        lv_obj_add_style(box, &style_card, 0);
+        lv_obj_set_style_pad_all(box, CARD_PAD, 0);
+        lv_obj_set_size(box, CARD_W, CARD_H);
+        lv_obj_set_pos(box, CARD_X, CARD_Y + ch * (CARD_H + CARD_GAP));
+        lv_obj_remove_flag(box, LV_OBJ_FLAG_SCROLLABLE);
+        
+        // Linke Spalte: Name, neuester Wert, Min/Max (Einheit oben rechts)
+        lv_obj_t* lbl_title = lv_label_create(box);
+        lv_obj_set_style_text_font(lbl_title, FONT_12, 0);
+        lv_obj_set_style_text_color(lbl_title, COLOR_TEXT_L, 0);
+        lv_label_set_text(lbl_title, def.title);
+        lv_obj_set_pos(lbl_title, 0, 0);
+        
+        lv_obj_t* lbl_unit = lv_label_create(box);
+        lv_obj_set_style_text_font(lbl_unit, FONT_12, 0);
+        lv_obj_set_style_text_color(lbl_unit, COLOR_DATE, 0);
+        lv_label_set_text(lbl_unit, def.unit);
+        lv_obj_align(lbl_unit, LV_ALIGN_TOP_RIGHT, 0, 0);
+        
+        card->lbl_value = lv_label_create(box);
+        lv_obj_set_style_text_font(card->lbl_value, FONT_20, 0);
+        lv_obj_set_style_text_color(card->lbl_value, COLOR_TEXT, 0);
+        lv_label_set_text(card->lbl_value, "--");
+        lv_obj_set_pos(card->lbl_value, 0, 16);
+        
+        card->lbl_max = lv_label_create(box);
+        lv_obj_set_style_text_font(card->lbl_max, FONT_12, 0);
+        lv_obj_set_style_text_color(card->lbl_max, COLOR_DATE, 0);
+        lv_label_set_text(card->lbl_max, "");
+        lv_obj_set_pos(card->lbl_max, 0, 42);
+        
+        card->lbl_min = lv_label_create(box);
+        lv_obj_set_style_text_font(card->lbl_min, FONT_12, 0);
+        lv_obj_set_style_text_color(card->lbl_min, COLOR_DATE, 0);
+        lv_label_set_text(card->lbl_min, "");
+        lv_obj_set_pos(card->lbl_min, 0, 56);
+        
+        // Chart: line only, no point markers, light grid
+        card->chart = lv_chart_create(box);
+        lv_obj_set_size(card->chart, HIST_CHART_W, CARD_H - 2 * CARD_PAD);
+        lv_obj_set_pos(card->chart, LEFT_W, 0);
+        lv_chart_set_type(card->chart, LV_CHART_TYPE_LINE);
+        lv_chart_set_div_line_count(card->chart, 3, 0);
+        lv_obj_set_style_bg_opa(card->chart, LV_OPA_TRANSP, 0);
+        lv_obj_set_style_border_width(card->chart, 0, 0);
+        lv_obj_set_style_pad_all(card->chart, 0, 0);
+        lv_obj_set_style_line_color(card->chart, COLOR_BAR_BG, LV_PART_MAIN);
+        lv_obj_set_style_line_width(card->chart, 2, LV_PART_ITEMS);
+        lv_obj_set_style_size(card->chart, 0, 0, LV_PART_INDICATOR);
+        lv_obj_remove_flag(card->chart, LV_OBJ_FLAG_CLICKABLE);
+        
+        card->series = lv_chart_add_series(card->chart, lv_color_hex(def.color), LV_CHART_AXIS_PRIMARY_Y);
+        lv_obj_move_foreground(lbl_unit);
+    }
+    
+    // Charts read the rings directly
+    hist_init();
+    s5_show_range(s5_range);
+    
+    Serial.println("[UI] Screen 5 (history) created");
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SCREEN DIRTY STATE
+ * ═══════════════════════════════════════════════════════════════════════════
+ * Updates only touch the active screen. Hidden screens just collect dirty
+ * bits and reconcile from cached_* when they are shown again.
+ */
+#define UI_DIRTY_TIME     0x01  // Time/date labels
+#define UI_DIRTY_SENSORS  0x02  // Sensor values, status colors
+#define UI_DIRTY_HISTORY  0x04  // New chart points in the shown range
+#define UI_DIRTY_ALL      (UI_DIRTY_TIME | UI_DIRTY_SENSORS | UI_DIRTY_HISTORY)
+
+struct ScreenUpdaters {
+    void (*time)();
+    void (*sensors)();
+    void (*history)();
+};
+
+static const ScreenUpdaters screen_updaters[UI_SCREEN_COUNT] = {
+    { nullptr,             update_screen0_tree,    nullptr },                 // Tree animation
+    { update_screen1_time, update_screen1_sensors, nullptr },                 // Overview
+    { update_screen2_time, update_screen2_sensors, nullptr },                 // Detail
+    { update_screen3_time, update_screen3_sensors, nullptr },                 // Analog cockpit
+    { update_screen4_time, update_screen4_sensors, nullptr },                 // Bubbles
+    { nullptr,             nullptr,                update_screen5_history },  // History
+};
+
+static uint8_t screen_dirty[UI_SCREEN_COUNT] = {
+    UI_DIRTY_ALL, UI_DIRTY_ALL, UI_DIRTY_ALL, UI_DIRTY_ALL, UI_DIRTY_ALL, UI_DIRTY_ALL
+};
+
+// Brings a screen up to date with the cached values
+static void reconcile_screen(UIScreen screen) {
+    if (ui_power_save) return;     // Nobody sees it: catch up on wake
+    
+    uint8_t dirty = screen_dirty[screen];
+    screen_dirty[screen] = 0;
+    
+    const ScreenUpdaters& u = screen_updaters[screen];
+    if ((dirty & UI_DIRTY_TIME) && u.time) u.time();
+    if ((dirty & UI_DIRTY_SENSORS) && u.sensors) u.sensors();
+    if ((dirty & UI_DIRTY_HISTORY) && u.history) u.history();
+}
+
+// Marks all screens dirty and updates the active one right away
+static void mark_dirty(uint8_t bits) {
+    for (int i = 0; i < UI_SCREEN_COUNT; i++) {
+        screen_dirty[i] |= bits;
+    }
+    reconcile_screen(current_screen);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SCREEN LIFECYCLE (lazy build, LRU teardown)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
-void ui_init() {
-    Serial.println("[UI] Initializing multi-screen UI...");
+// Forget the element pointers of a deleted screen
+static void release_screen0() {
+    s0_tree_img = nullptr;
+    s0_leaf_yellow_1 = nullptr;
+    s0_leaf_yellow_2 = nullptr;
+    s0_leaf_red = nullptr;
+    s0_last_air_status = GOOD;
     
-    init_styles();
+    // Decoded images are no longer referenced
+    for (int i = 0; i < 3; i++) {
+        if (s0_tree_dsc[i]) ui_asset_release(s0_tree_packed[i]);
+        s0_tree_dsc[i] = nullptr;
+    }
+    for (int i = 0; i < 3; i++) {
+        if (s0_leaf_dsc[i]) ui_asset_release(s0_leaf_packed[i]);
+        s0_leaf_dsc[i] = nullptr;
+        s0_leaf_frame[i] = -1;
+    }
+    s0_free_leaf_sprites();
+}
+
+static void release_screen1() {
+    clock_release(&s1_clock);
+    s1_lbl_date = nullptr;
+    s1_aqi_box = s1_arc_aqi = s1_img_emoji = nullptr;
+    s1_lbl_aqi_title = s1_lbl_aqi_status = nullptr;
+    s1_card_temp = s1_lbl_temp_title = s1_img_temp = nullptr;
+    s1_lbl_temp_value = s1_lbl_temp_unit = s1_bar_temp = nullptr;
+    s1_card_hum = s1_lbl_hum_title = s1_img_hum = nullptr;
+    s1_lbl_hum_value = s1_lbl_hum_unit = s1_bar_hum = nullptr;
+}
+
+static void release_screen2() {
+    clock_release(&s2_clock);
+    s2_lbl_date = nullptr;
+    s2_arc_aqi = s2_img_emoji = s2_lbl_aqi_title = s2_lbl_aqi_status = nullptr;
+    s2_card_climate = nullptr;
+    s2_lbl_temp_title = s2_img_temp = s2_lbl_temp_value = s2_lbl_temp_unit = s2_bar_temp = nullptr;
+    s2_lbl_hum_title = s2_img_hum = s2_lbl_hum_value = s2_lbl_hum_unit = s2_bar_hum = nullptr;
+    memset(s2_cards, 0, sizeof(s2_cards));
+}
+
+static void release_screen3() {
+    s3_lbl_time = s3_lbl_date = s3_lbl_brand = nullptr;
     
-    // Create all five screens
-    create_screen0_tree();   // Tree animation (start screen)
-    create_screen1();        // Overview (minimalistic)
-    create_screen2();        // Detail (full info)
-    create_screen3_analog(); // Analog cockpit (instruments)
-    create_screen4_bubble(); // Dynamic circles (bubbles)
+    // Needle animations run on the gauge structs, not on the objects
+    lv_anim_delete(&s3_gauge_temp, NULL);
+    lv_anim_delete(&s3_gauge_co2, NULL);
+    lv_anim_delete(&s3_gauge_hum, NULL);
+    memset(&s3_gauge_temp, 0, sizeof(s3_gauge_temp));
+    memset(&s3_gauge_co2, 0, sizeof(s3_gauge_co2));
+    memset(&s3_gauge_hum, 0, sizeof(s3_gauge_hum));
+    ui_sprite_free(&s3_face_buf);
+}
+
+static void release_screen4() {
+    s4_lbl_time = s4_lbl_date = nullptr;
+    memset(s4_bubbles, 0, sizeof(s4_bubbles));
+    s4_free_sprites();
+}
+
+static void release_screen5() {
+    // The rings stay, they belong to the decimators
+    memset(s5_cards, 0, sizeof(s5_cards));
+    memset(s5_lbl_ranges, 0, sizeof(s5_lbl_ranges));
+}
+
+struct ScreenLifecycle {
+    void (*create)();
+    void (*release)();
+};
+
+static const ScreenLifecycle screen_lifecycle[UI_SCREEN_COUNT] = {
+    { create_screen0_tree,    release_screen0 },
+    { create_screen1,         release_screen1 },
+    { create_screen2,         release_screen2 },
+    { create_screen3_analog,  release_screen3 },
+    { create_screen4_bubble,  release_screen4 },
+    { create_screen5_history, release_screen5 },
+};
+
+static void log_mem_change(const char* what, int screen, const lv_mem_monitor_t& before) {
+    lv_mem_monitor_t after;
+    lv_mem_monitor(&after);
+    Serial.printf("[UI] %s screen %d: LVGL heap %d%% -> %d%% used, free %lu KB (biggest %lu KB)\n",
+                  what, screen, before.used_pct, after.used_pct,
+                  (unsigned long)(after.free_size / 1024),
+                  (unsigned long)(after.free_biggest_size / 1024));
+}
+
+static void destroy_screen(int screen) {
+    lv_mem_monitor_t before;
+    lv_mem_monitor(&before);
     
-    // Start with screen 0 (tree animation)
-    current_screen = UI_SCREEN_TREE;
-    lv_screen_load(screens[current_screen]);
+    lv_obj_delete(screens[screen]);  // Also deletes its animations
+    screens[screen] = nullptr;
+    screen_lifecycle[screen].release();
     
-    Serial.println("[UI] Multi-screen UI initialized, starting with tree animation");
+    log_mem_change("Freed", screen, before);
 }
 
-void ui_nextScreen() {
-    Serial.println("[UI] ui_nextScreen() called");
-    Serial.flush();
-    Serial.printf("[UI] Current screen: %d, screens[0]=%p, screens[1]=%p\n", 
-                  current_screen, screens[0], screens[1]);
-    Serial.flush();
+// Deletes least recently used inactive screens while LVGL heap is low
+static void evict_screens(UIScreen keep) {
+    for (;;) {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        if (mon.free_size >= UI_MEM_LOW_WATERMARK) return;
+        
+        int lru = -1;
+        for (int i = 0; i < UI_SCREEN_COUNT; i++) {
+            if (!screens[i] || i == current_screen || i == keep) continue;
+            if (lru < 0 || screen_last_used[i] < screen_last_used[lru]) lru = i;
+        }
+        if (lru < 0) return;
+        destroy_screen(lru);
+    }
+}
+
+// Builds a screen if it does not exist (yet or anymore)
+static bool ensure_screen(UIScreen screen) {
+    if (screens[screen]) return true;
+    
+    evict_screens(screen);
+    
+    lv_mem_monitor_t before;
+    lv_mem_monitor(&before);
+    screen_lifecycle[screen].create();
+    screen_dirty[screen] = UI_DIRTY_ALL;
+    log_mem_change("Built", screen, before);
     
-    int next = (current_screen + 1) % UI_SCREEN_COUNT;
-    Serial.printf("[UI] Switching to screen: %d\n", next);
-    Serial.flush();
-    ui_setScreen((UIScreen)next);
+    return screens[screen] != nullptr;
 }
 
-void ui_setScreen(UIScreen screen) {
-    Serial.printf("[UI] ui_setScreen(%d) called\n", screen);
-    Serial.flush();
+static void print_memory() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    Serial.printf("[UI] LVGL heap: %d%% used (max %lu KB), free %lu KB, biggest %lu KB, frag %d%%\n",
+                  mon.used_pct, (unsigned long)(mon.max_used / 1024),
+                  (unsigned long)(mon.free_size / 1024),
+                  (unsigned long)(mon.free_biggest_size / 1024), mon.frag_pct);
+    Serial.print("[UI] Resident screens:");
+    for (int i = 0; i < UI_SCREEN_COUNT; i++) {
+        if (screens[i]) Serial.printf(" %d", i);
+    }
+    Serial.println();
+    uint32_t view_total = view_updates_applied + view_updates_skipped;
+    Serial.printf("[UI] Widget updates: %lu applied, %lu skipped (%lu%% avoided)\n",
+                  (unsigned long)view_updates_applied, (unsigned long)view_updates_skipped,
+                  (unsigned long)(view_total ? (uint64_t)view_updates_skipped * 100 / view_total : 0));
+    ui_asset_print_stats();
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SCREEN TRANSITIONS (snapshot based)
+ * ═══════════════════════════════════════════════════════════════════════════
+ * The outgoing and the incoming screen are rendered once into RGB565
+ * snapshots in PSRAM. During the animation only these two images move
+ * (slide) or blend (fade) on a bare transition screen, so every frame is
+ * two image blits instead of two live widget trees. The real screen is
+ * loaded when the animation ends; without PSRAM screens load directly.
+ */
+#define UI_TRANSITION_MS    300
+#define UI_TRANSITION_FADE  0       // 0 = slide (direction by screen order), 1 = cross-fade
+
+static lv_obj_t* trans_scr = nullptr;
+static lv_obj_t* trans_img_out = nullptr;
+static lv_obj_t* trans_img_in = nullptr;
+static lv_draw_buf_t trans_buf_out;
+static lv_draw_buf_t trans_buf_in;
+static UIScreen trans_target = UI_SCREEN_TREE;     // Also the animation var
+static bool trans_running = false;
+static int8_t trans_dir = 1;                        // 1 = new screen enters from the right
+static uint32_t trans_start_tick = 0;
+
+static void transition_exec_cb(void* var, int32_t v) {
+#if UI_TRANSITION_FADE
+    lv_obj_set_style_image_opa(trans_img_in, (lv_opa_t)v, 0);
+#else
+    lv_obj_set_x(trans_img_out, -trans_dir * v);
+    lv_obj_set_x(trans_img_in, trans_dir * (SCREEN_WIDTH - v));
+#endif
+}
+
+static void transition_free() {
+    if (trans_img_out) lv_image_set_src(trans_img_out, NULL);
+    if (trans_img_in) lv_image_set_src(trans_img_in, NULL);
+    ui_sprite_free(&trans_buf_out);
+    ui_sprite_free(&trans_buf_in);
+}
+
+// Loads the target screen and drops the snapshots
+static void transition_end(bool from_anim) {
+    if (!trans_running) return;
+    trans_running = false;
+    if (!from_anim) lv_anim_delete(&trans_target, NULL);
     
+    lv_screen_load(screens[trans_target]);
+    transition_free();
+    Serial.printf("[UI] Transition to screen %d done after %lu ms\n",
+                  trans_target, (unsigned long)lv_tick_elaps(trans_start_tick));
+}
+
+static void transition_completed_cb(lv_anim_t* a) {
+    transition_end(true);
+}
+
+static void transition_create_screen() {
+    trans_scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(trans_scr, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(trans_scr, LV_OPA_COVER, 0);
+    lv_obj_remove_flag(trans_scr, LV_OBJ_FLAG_SCROLLABLE);
+    
+    trans_img_out = lv_image_create(trans_scr);
+    trans_img_in = lv_image_create(trans_scr);
+}
+
+/**
+ * Starts an animated switch from the active screen to `to`
+ * @param dir 1 = slide to the left (next screen), -1 = to the right
+ * @return false if it cannot animate (caller loads the screen directly)
+ */
+static bool transition_start(UIScreen from, UIScreen to, int8_t dir) {
+    if (!screens[from] || from == to) return false;
+    if (!ui_sprite_alloc(&trans_buf_out, SCREEN_WIDTH, SCREEN_HEIGHT, LV_COLOR_FORMAT_RGB565) ||
+        !ui_sprite_alloc(&trans_buf_in, SCREEN_WIDTH, SCREEN_HEIGHT, LV_COLOR_FORMAT_RGB565)) {
+        transition_free();
+        return false;
+    }
+    
+    uint32_t t0 = micros();
+    lv_obj_update_layout(screens[to]);
+    if (lv_snapshot_take_to_draw_buf(screens[from], LV_COLOR_FORMAT_RGB565, &trans_buf_out) != LV_RESULT_OK ||
+        lv_snapshot_take_to_draw_buf(screens[to], LV_COLOR_FORMAT_RGB565, &trans_buf_in) != LV_RESULT_OK) {
+        transition_free();
+        return false;
+    }
+    
+    if (!trans_scr) transition_create_screen();
+    lv_image_set_src(trans_img_out, &trans_buf_out);
+    lv_image_set_src(trans_img_in, &trans_buf_in);
+    lv_obj_set_pos(trans_img_out, 0, 0);
+    lv_obj_set_pos(trans_img_in, 0, 0);
+#if UI_TRANSITION_FADE
+    lv_obj_set_style_image_opa(trans_img_in, LV_OPA_TRANSP, 0);
+    const int32_t end = LV_OPA_COVER;
+#else
+    const int32_t end = SCREEN_WIDTH;
+#endif
+    
+    trans_target = to;
+    trans_dir = dir;
+    trans_running = true;
+    trans_start_tick = lv_tick_get();
+    transition_exec_cb(nullptr, 0);
+    lv_screen_load(trans_scr);
+    
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &trans_target);
+    lv_anim_set_exec_cb(&a, transition_exec_cb);
+    lv_anim_set_values(&a, 0, end);
+    lv_anim_set_duration(&a, UI_TRANSITION_MS);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_set_completed_cb(&a, transition_completed_cb);
+    lv_anim_start(&a);
+    
+    Serial.printf("[UI] Transition %d -> %d: snapshots in %lu us\n",
+                  from, to, (unsigned long)(micros() - t0));
+    return true;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * UI MESSAGE QUEUE
+ * ═══════════════════════════════════════════════════════════════════════════
+ * The public ui_* functions may be called from any task. They only post a
+ * message; the LVGL render task applies it in ui_processMessages().
+ */
+enum UIMessageType : uint8_t {
+    UI_MSG_NEXT_SCREEN,
+    UI_MSG_SET_SCREEN,
+    UI_MSG_TIME,
+    UI_MSG_DATE,
+    UI_MSG_SENSORS,
+    UI_MSG_HISTORY,
+    UI_MSG_POWER_SAVE,
+    UI_MSG_PRINT_MEMORY
+};
+
+struct UIMessage {
+    UIMessageType type;
+    union {
+        UIScreen screen;
+        bool power_save;
+        struct { int8_t hour, minute, second; } time;
+        char date[24];
+        struct { float temp, hum; int co2, pm25, pm10, voc; } sensors;
+        struct { uint32_t timestamp; float temp; int co2, pm25; } history;
+    };
+};
+
+#define UI_QUEUE_LENGTH 16
+
+static QueueHandle_t ui_queue = nullptr;
+static uint32_t ui_dropped = 0;
+
+static bool ui_post(const UIMessage& msg) {
+    if (ui_queue == nullptr || xQueueSend(ui_queue, &msg, 0) != pdTRUE) {
+        ui_dropped++;
+        return false;
+    }
+    lvgl_wake();    // Render task sleeps until its next deadline otherwise
+    return true;
+}
+
+/**
+ * Switches screens (animated if possible)
+ * @param dir Slide direction: 1 = next screen comes from the right
+ */
+static void apply_set_screen(UIScreen screen, int8_t dir) {
     if (screen >= UI_SCREEN_COUNT) {
         Serial.println("[UI] ERROR: Screen index invalid!");
         return;
     }
-    if (screens[screen] == nullptr) {
-        Serial.println("[UI] ERROR: Screen is NULL!");
+    
+    // A running transition is cut short: its target is the screen we leave
+    transition_end(false);
+    UIScreen from = current_screen;
+    if (screen == from && lv_screen_active() == screens[screen]) return;
+    
+    if (!ensure_screen(screen)) {
+        Serial.println("[UI] ERROR: Screen could not be created!");
         return;
     }
-    
-    Serial.println("[UI] Starting screen transition...");
-    Serial.flush();
     current_screen = screen;
+    screen_last_used[screen] = lv_tick_get();
+    
+    // History always opens with the shortest range
+    if (screen == UI_SCREEN_HISTORY) s5_show_range(HIST_RANGE_1H);
+    
+    // Nachholen, was sich seit dem letzten Anzeigen geändert hat (before
+    // the snapshot, so the transition already shows current values)
+    reconcile_screen(screen);
     
-    // Simple load instead of animation (safer)
-    Serial.println("[UI] Before lv_screen_load()...");
-    Serial.flush();
-    lv_screen_load(screens[screen]);
-    Serial.println("[UI] After lv_screen_load()");
-    Serial.flush();
-    
-    // Aktuellen Screen mit gecachten Werten aktualisieren
-    if (screen == UI_SCREEN_TREE) {
-        Serial.println("[UI] Vor update_screen0_tree()...");
-        Serial.flush();
-        update_screen0_tree();
-    } else if (screen == UI_SCREEN_OVERVIEW) {
-        Serial.println("[UI] Vor update_screen1_time()...");
-        Serial.flush();
-        update_screen1_time();
-        Serial.println("[UI] Vor update_screen1_sensors()...");
-        Serial.flush();
-        update_screen1_sensors();
-    } else if (screen == UI_SCREEN_DETAIL) {
-        Serial.println("[UI] Vor update_screen2_time()...");
-        Serial.flush();
-        update_screen2_time();
-        Serial.println("[UI] Vor update_screen2_sensors()...");
-        Serial.flush();
-        update_screen2_sensors();
-    } else if (screen == UI_SCREEN_ANALOG) {
-        Serial.println("[UI] Vor update_screen3_time()...");
-        Serial.flush();
-        update_screen3_time();
-        Serial.println("[UI] Vor update_screen3_sensors()...");
-        Serial.flush();
-        update_screen3_sensors();
-    } else if (screen == UI_SCREEN_BUBBLE) {
-        Serial.println("[UI] Vor update_screen4_time()...");
-        Serial.flush();
-        update_screen4_time();
-        Serial.println("[UI] Vor update_screen4_sensors()...");
-        Serial.flush();
-        update_screen4_sensors();
-    }
-    
-    const char* screen_names[] = {"Tree Animation", "Overview", "Detail", "Analog Cockpit", "Bubbles"};
-    Serial.printf("[UI] Switch to screen %d (%s) completed\n", screen, screen_names[screen]);
-    Serial.flush();
+    if (!transition_start(from, screen, dir)) {
+        lv_screen_load(screens[screen]);
+    }
+    
+    // Free old screens if the new one left the heap tight
+    evict_screens(screen);
+    
+    const char* screen_names[] = {"Tree Animation", "Overview", "Detail", "Analog Cockpit", "Bubbles", "History"};
+    Serial.printf("[UI] Switch to screen %d (%s)\n", screen, screen_names[screen]);
 }
 
-UIScreen ui_getCurrentScreen() {
-    return current_screen;
+static void apply_next_screen() {
+    // On the history screen the button first steps through the ranges
+    if (current_screen == UI_SCREEN_HISTORY && s5_range + 1 < HIST_RANGE_COUNT) {
+        transition_end(false);
+        s5_show_range((HistRange)(s5_range + 1));
+        return;
+    }
+    apply_set_screen((UIScreen)((current_screen + 1) % UI_SCREEN_COUNT), 1);
 }
 
-void ui_updateTime(int hour, int minute, int second) {
+static void apply_time(int hour, int minute, int second) {
     // Cache aktualisieren
     cached_hour = hour;
     cached_min = minute;
     cached_sec = second;
     
-    // Alle Screens aktualisieren (nur der aktive ist sichtbar)
-    update_screen1_time();
-    update_screen2_time();
-    update_screen3_time();
-    update_screen4_time();
+    // Nur der aktive Screen wird sofort aktualisiert
+    mark_dirty(UI_DIRTY_TIME);
 }
 
-void ui_updateDate(const char* date_str) {
-    if (!date_str) return;
+static void apply_date(const char* date_str) {
     strncpy(cached_date, date_str, sizeof(cached_date) - 1);
     cached_date[sizeof(cached_date) - 1] = '\0';
     
-    if (s1_lbl_date) lv_label_set_text(s1_lbl_date, cached_date);
-    if (s2_lbl_date) lv_label_set_text(s2_lbl_date, cached_date);
-    if (s3_lbl_date) lv_label_set_text(s3_lbl_date, cached_date);
-    if (s4_lbl_date) lv_label_set_text(s4_lbl_date, cached_date);
+    // Date labels are set by the time updaters
+    mark_dirty(UI_DIRTY_TIME);
 }
 
-void ui_updateSensorValues(float temp, float hum, int co2, int pm25, int voc) {
+static void apply_sensor_values(float temp, float hum, int co2, int pm25, int pm10, int voc) {
     // Cache aktualisieren
     cached_temp = temp;
     cached_hum = hum;
     cached_co2 = co2;
     cached_pm25 = pm25;
     cached_voc = voc;
+
+    // Einmal klassifizieren, alle Screens lesen cached_aqi
+    cached_aqi = aqi_evaluate(temp, hum, co2, pm25, pm10, voc);
+    
+    // Nur der aktive Screen wird sofort aktualisiert
+    mark_dirty(UI_DIRTY_SENSORS);
+}
+
+static void apply_history_point(uint32_t timestamp, float temp, int co2, int pm25) {
+    if (!hist_add(timestamp, temp, co2, pm25)) return;
+    
+    // Only the history screen shows it
+    screen_dirty[UI_SCREEN_HISTORY] |= UI_DIRTY_HISTORY;
+    if (current_screen == UI_SCREEN_HISTORY) {
+        reconcile_screen(current_screen);
+    }
+}
+
+static void apply_power_save(bool on) {
+    if (on == ui_power_save) return;
+    
+    if (on) {
+        transition_end(false);
+        s0_pause_leaves(true);
+        ui_power_save = true;
+    } else {
+        ui_power_save = false;
+        s0_pause_leaves(false);
+        reconcile_screen(current_screen);
+    }
+    Serial.printf("[UI] Power save %s\n", on ? "on" : "off");
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PUBLIC API FUNCTIONS
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+void ui_init() {
+    Serial.println("[UI] Initializing multi-screen UI...");
+    
+    init_styles();
     
-    Serial.printf("[UI] Update: T=%.1f H=%.0f CO2=%d PM=%d VOC=%d\n", temp, hum, co2, pm25, voc);
+    if (ui_queue == nullptr) {
+        ui_queue = xQueueCreate(UI_QUEUE_LENGTH, sizeof(UIMessage));
+    }
+    
+    // Only the start screen is built now, the others on first use
+    current_screen = UI_SCREEN_TREE;
+    ensure_screen(current_screen);
+    screen_last_used[current_screen] = lv_tick_get();
+    lv_screen_load(screens[current_screen]);
     
-    // Alle Screens aktualisieren
-    update_screen0_tree();    // Tree screen changes color based on air quality
-    update_screen1_sensors();
-    update_screen2_sensors();
-    update_screen3_sensors(); // Analog Cockpit
-    update_screen4_sensors(); // Bubbles
+    Serial.println("[UI] Multi-screen UI initialized, starting with tree animation");
+    print_memory();
+}
+
+void ui_processMessages() {
+    if (ui_queue == nullptr) return;
+    
+    UIMessage msg;
+    while (xQueueReceive(ui_queue, &msg, 0) == pdTRUE) {
+        switch (msg.type) {
+            case UI_MSG_NEXT_SCREEN:
+                apply_next_screen();
+                break;
+            case UI_MSG_SET_SCREEN:
+                apply_set_screen(msg.screen, (msg.screen >= current_screen) ? 1 : -1);
+                break;
+            case UI_MSG_TIME:
+                apply_time(msg.time.hour, msg.time.minute, msg.time.second);
+                break;
+            case UI_MSG_DATE:
+                apply_date(msg.date);
+                break;
+            case UI_MSG_SENSORS:
+                apply_sensor_values(msg.sensors.temp, msg.sensors.hum, msg.sensors.co2,
+                                    msg.sensors.pm25, msg.sensors.pm10, msg.sensors.voc);
+                break;
+            case UI_MSG_HISTORY:
+                apply_history_point(msg.history.timestamp, msg.history.temp,
+                                    msg.history.co2, msg.history.pm25);
+                break;
+            case UI_MSG_POWER_SAVE:
+                apply_power_save(msg.power_save);
+                break;
+            case UI_MSG_PRINT_MEMORY:
+                print_memory();
+                break;
+        }
+    }
+}
+
+void ui_nextScreen() {
+    UIMessage msg;
+    msg.type = UI_MSG_NEXT_SCREEN;
+    ui_post(msg);
+}
+
+void ui_setScreen(UIScreen screen) {
+    UIMessage msg;
+    msg.type = UI_MSG_SET_SCREEN;
+    msg.screen = screen;
+    ui_post(msg);
+}
+
+UIScreen ui_getCurrentScreen() {
+    return current_screen;
+}
+
+void ui_updateTime(int hour, int minute, int second) {
+    UIMessage msg;
+    msg.type = UI_MSG_TIME;
+    msg.time.hour = hour;
+    msg.time.minute = minute;
+    msg.time.second = second;
+    ui_post(msg);
+}
+
+void ui_updateDate(const char* date_str) {
+    if (!date_str) return;
+    UIMessage msg;
+    msg.type = UI_MSG_DATE;
+    strncpy(msg.date, date_str, sizeof(msg.date) - 1);
+    msg.date[sizeof(msg.date) - 1] = '\0';
+    ui_post(msg);
+}
+
+void ui_updateSensorValues(float temp, float hum, int co2, int pm25, int pm10, int voc) {
+    UIMessage msg;
+    msg.type = UI_MSG_SENSORS;
+    msg.sensors.temp = temp;
+    msg.sensors.hum = hum;
+    msg.sensors.co2 = co2;
+    msg.sensors.pm25 = pm25;
+    msg.sensors.pm10 = pm10;
+    msg.sensors.voc = voc;
+    ui_post(msg);
+}
+
+bool ui_addHistoryPoint(uint32_t timestamp, float temp, int co2, int pm25) {
+    UIMessage msg;
+    msg.type = UI_MSG_HISTORY;
+    msg.history.timestamp = timestamp;
+    msg.history.temp = temp;
+    msg.history.co2 = co2;
+    msg.history.pm25 = pm25;
+    return ui_post(msg);
+}
+
+void ui_loadHistoryPoint(uint32_t timestamp, float temp, int co2, int pm25) {
+    apply_history_point(timestamp, temp, co2, pm25);
+}
+
+void ui_setPowerSave(bool on) {
+    UIMessage msg;
+    msg.type = UI_MSG_POWER_SAVE;
+    msg.power_save = on;
+    ui_post(msg);
+}
+
+void ui_printMemory() {
+    UIMessage msg;
+    msg.type = UI_MSG_PRINT_MEMORY;
+    ui_post(msg);
+}
+
+uint32_t ui_getDroppedMessages() {
+    return ui_dropped;
+}
+
+void ui_benchmarkLeafSprites() {
+    const int rounds = 60;
+    lvgl_lock();
+
+    if (current_screen != UI_SCREEN_TREE || !s0_tree_img) {
+        Serial.println("[UI] Leaf benchmark needs the tree screen");
+        lvgl_unlock();
+        return;
+    }
+
+    // All three leaves visible at fixed spots, no running animations
+    for (int i = 0; i < 3; i++) {
+        lv_obj_t* leaf = s0_leaf_obj(i);
+        lv_anim_delete(leaf, NULL);
+        lv_obj_set_style_opa(leaf, LV_OPA_COVER, 0);
+        lv_obj_set_pos(leaf, 140 + i * 80, 150);
+        lv_obj_remove_flag(leaf, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    bool saved = s0_leaf_use_sprites;
+    Serial.println("[UI] Leaf benchmark (3 leaves swinging -25..25 deg):");
+    for (int mode = 0; mode < 2; mode++) {
+        s0_set_leaf_mode(mode == 1);
+        if (mode == 1 && !s0_leaf_use_sprites) break;
+
+        uint32_t t0 = micros();
+        for (int r = 0; r < rounds; r++) {
+            int32_t deg = S0_LEAF_ANGLE_MIN + (r * S0_LEAF_ANGLE_STEP) % (S0_LEAF_FRAMES * S0_LEAF_ANGLE_STEP);
+            for (int i = 0; i < 3; i++) {
+                s0_set_leaf_angle(s0_leaf_obj(i), deg);
+            }
+            lv_refr_now(NULL);
+            lvgl_finish_frame();
+        }
+        uint32_t perFrame = (micros() - t0) / rounds;
+        Serial.printf("  %-13s %6lu us/frame\n",
+                      s0_leaf_use_sprites ? "sprite frames" : "live rotation", (unsigned long)perFrame);
+    }
+
+    // Back to the normal state
+    s0_set_leaf_mode(saved);
+    Status air = s0_last_air_status;
+    s0_show_green();
+    if (air == WARN) s0_show_yellow();
+    else if (air == BAD) s0_show_red();
+
+    lvgl_unlock();
 }
 
 void ui_updateSensors(const SensorReadings& readings) {
@@ -2098,6 +3486,7 @@ void ui_updateSensors(const SensorReadings& readings) {
         readings.aht.humidity,
         readings.mhz.co2_ppm,
         readings.pms.PM_AE_UG_2_5,
+        readings.pms.PM_AE_UG_10_0,
         readings.sgp.voc_index
     );
 }
@@ -9,6 +9,7 @@
  * Multi-Screen UI System:
  * - Screen 1 (Overview): Large AQI right, 2 tiles Temp/Hum left
  * - Screen 2 (Detail): Small AQI, 4 tiles with all values
+ * - Screen 5 (History): CO2/PM2.5/temperature charts for 1h, 24h, 7d
  */
 
 #ifndef UI_MANAGER_H
@@ -35,12 +36,17 @@ enum UIScreen {
     UI_SCREEN_DETAIL   = 2,  // Small AQI + 4 tiles (full info)
     UI_SCREEN_ANALOG   = 3,  // Analog cockpit gauges
     UI_SCREEN_BUBBLE   = 4,  // Dynamic circles (modern bubbles)
-    UI_SCREEN_COUNT    = 5   // Number of screens
+    UI_SCREEN_HISTORY  = 5,  // History charts (button steps 1h → 24h → 7d)
+    UI_SCREEN_COUNT    = 6   // Number of screens
 };
 
 /* ═══════════════════════════════════════════════════════════════════════════
  * API FUNCTIONS
- * ═══════════════════════════════════════════════════════════════════════════ */
+ * ═══════════════════════════════════════════════════════════════════════════
+ * ui_init() and ui_processMessages() run with LVGL locked. All other
+ * functions are safe to call from any task: they queue the update and the
+ * LVGL render task applies it before its next frame.
+ */
 
 /**
  * Initializes all LVGL UI screens
@@ -48,6 +54,28 @@ enum UIScreen {
  */
 void ui_init(void);
 
+/**
+ * Applies all queued UI updates (called by the LVGL render task)
+ */
+void ui_processMessages(void);
+
+/**
+ * Prints LVGL heap usage and the currently built screens
+ * (screens are built on first use and freed again when memory is low)
+ */
+void ui_printMemory(void);
+
+/**
+ * Returns the number of UI updates dropped because the queue was full
+ */
+uint32_t ui_getDroppedMessages(void);
+
+/**
+ * Benchmark: tree screen frame time with pre-rotated leaf sprites vs.
+ * live rotation (call before lvgl_start_task(), tree screen active)
+ */
+void ui_benchmarkLeafSprites(void);
+
 /**
  * Switches to the next screen (cyclic)
  */
@@ -85,9 +113,33 @@ void ui_updateDate(const char* date_str);
  * @param hum Humidity in %
  * @param co2 CO2 in ppm
  * @param pm25 PM2.5 in µg/m³
+ * @param pm10 PM10 in µg/m³
  * @param voc VOC index (0-500)
  */
-void ui_updateSensorValues(float temp, float hum, int co2, int pm25, int voc);
+void ui_updateSensorValues(float temp, float hum, int co2, int pm25, int pm10, int voc);
+
+/**
+ * Adds a new per-minute history value to the history charts
+ * @param timestamp Unix time of the entry
+ * @param temp Temperature in °C
+ * @param co2 CO2 in ppm
+ * @param pm25 PM2.5 in µg/m³
+ * @return false if the UI queue was full (point not taken, retry later)
+ */
+bool ui_addHistoryPoint(uint32_t timestamp, float temp, int co2, int pm25);
+
+/**
+ * Like ui_addHistoryPoint(), but applied right away - for replaying the
+ * stored history at boot (before lvgl_start_task() or with LVGL locked)
+ */
+void ui_loadHistoryPoint(uint32_t timestamp, float temp, int co2, int pm25);
+
+/**
+ * Power save while the display is blanked: stops the tree leaf
+ * animations and defers all widget updates until it is switched off
+ * @param on true = display blanked
+ */
+void ui_setPowerSave(bool on);
 
 /**
  * Updates all sensor values from SensorReadings structure
@@ -22,6 +22,7 @@
 #include <lvgl.h>
 #include "display/lvgl_driver.h"
 #include "display/ui_manager.h"
+#include "display/display_power.h"
 
 // Projekt-Header
 #include "pins.h"
@@ -33,6 +34,9 @@
 #include "WifiClock.h"
 #include "utils/sensor_filter.h"
 #include "utils/sensor_history.h"
+#include "utils/sensor_quantiles.h"
+#include "utils/exposure_tracker.h"
+#include <esp_pm.h>
 
 // ============================================
 // WIFI CONFIGURATION
@@ -56,6 +60,24 @@ static const unsigned long BUTTON_DEBOUNCE_MS = 250;  // Debounce time
 static bool lastButtonState = HIGH;  // Button is active LOW with pullup
 #endif
 
+// ============================================
+// BENCHMARK CONFIGURATION
+// ============================================
+// Run layout/render benchmarks once at boot (prints results to Serial)
+// #define RUN_BENCHMARKS_ON_BOOT
+
+// ============================================
+// POWER CONFIGURATION
+// ============================================
+// Pause of loop() per pass: lets the idle task run between sensor polls
+// (UART RX buffers easily hold 5 ms of radar/PMS data)
+#define LOOP_IDLE_MS 5
+
+// Automatic light sleep while all tasks block (render task idle, loop()
+// pausing). Needs CONFIG_PM_ENABLE and CONFIG_FREERTOS_USE_TICKLESS_IDLE
+// in the SDK config; the SoftwareSerial CO2 link may drop bytes then
+// #define ENABLE_LIGHT_SLEEP
+
 // ============================================
 // GLOBAL OBJECTS
 // ============================================
@@ -118,26 +140,25 @@ void checkUIButton() {
         Serial.printf("[BUTTON] >>> STATE CHANGE! GPIO%d: %s -> %s <<<\n", PIN_UI_BUTTON, 
                       lastButtonState ? "HIGH" : "LOW",
                       currentState ? "HIGH" : "LOW");
-        Serial.flush();  // Output immediately before potential crash
     }
     
     // Detect falling edge (HIGH -> LOW = button pressed)
     if (lastButtonState == HIGH && currentState == LOW) {
-        Serial.println("[BUTTON] *** BUTTON PRESSED - before ui_nextScreen() ***");
-        Serial.flush();
+        Serial.println("[BUTTON] *** BUTTON PRESSED ***");
         
         // Debounce check
         if (millis() - lastButtonPress > BUTTON_DEBOUNCE_MS) {
             lastButtonPress = millis();
             
-            Serial.println("[BUTTON] Calling ui_nextScreen()...");
-            Serial.flush();
-            
-            // Switch to next screen
-            ui_nextScreen();
-            
-            Serial.printf("[BUTTON] Screen switched to: %d\n", ui_getCurrentScreen());
-            Serial.flush();
+            // A blanked display only wakes up, the press does not switch
+            if (displayPower.wake()) {
+                Serial.println("[BUTTON] Display woken");
+            } else {
+                // Switch to next screen (applied by the LVGL task)
+                ui_nextScreen();
+                
+                Serial.printf("[BUTTON] Screen switch queued (current: %d)\n", ui_getCurrentScreen());
+            }
         } else {
             Serial.println("[BUTTON] Debounced (ignored)");
         }
@@ -147,6 +168,89 @@ void checkUIButton() {
 }
 #endif
 
+// ============================================
+// SERIAL DEBUG COMMANDS
+// ============================================
+/**
+ * Single-character commands from the serial monitor:
+ *   o = toggle render profiler overlay
+ *   p = print profiler histograms
+ *   r = reset profiler
+ */
+void checkSerialCommands() {
+    while (Serial.available() > 0) {
+        switch (Serial.read()) {
+            case 'o':
+                lvgl_profiler_set_overlay(!lvgl_profiler_overlay_enabled());
+                Serial.printf("[PROF] Overlay %s\n", lvgl_profiler_overlay_enabled() ? "on" : "off");
+                break;
+            case 'p':
+                lvgl_profiler_dump();
+                break;
+            case 'r':
+                lvgl_profiler_reset();
+                Serial.println("[PROF] Reset");
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// ============================================
+// HISTORY CHARTS
+// ============================================
+static uint32_t historyChartSeq = 0;    // Next history entry for the charts
+
+/**
+ * Passes new per-minute history entries to the history screen
+ * @param replay true at boot (before lvgl_start_task()): applied right away
+ */
+void feedHistoryCharts(bool replay) {
+    uint32_t total = sensorHistory.getTotalAppended();
+    HistoryEntry e;
+    if (historyChartSeq > total) historyChartSeq = 0;   // History was cleared
+    for (; historyChartSeq < total; historyChartSeq++) {
+        // Already overwritten in the ring: lost for the charts
+        if (!sensorHistory.getEntryBySequence(historyChartSeq, e)) continue;
+        
+        // No time sync yet: retry once the entry is rebased to Unix time
+        if (e.timestamp < HISTORY_UNIX_MIN) break;
+        
+        // Charts keep their points: stay on the time base before clock steps
+        uint32_t ts = e.timestamp + sensorHistory.getTimeShift();
+        float temp = e.temp_x10 / 10.0f;
+        if (replay) {
+            ui_loadHistoryPoint(ts, temp, e.co2, e.pm25);
+        } else if (!ui_addHistoryPoint(ts, temp, e.co2, e.pm25)) {
+            break;  // UI queue full: same entry again on the next pass
+        }
+    }
+}
+
+// ============================================
+// POWER MANAGEMENT
+// ============================================
+/**
+ * Enables dynamic frequency scaling and automatic light sleep
+ * (only with ENABLE_LIGHT_SLEEP and a PM-enabled SDK config)
+ */
+void configurePowerManagement() {
+    #if defined(ENABLE_LIGHT_SLEEP) && CONFIG_PM_ENABLE
+    esp_pm_config_esp32s3_t pm = {};
+    pm.max_freq_mhz = 240;
+    pm.min_freq_mhz = 80;
+    #if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    pm.light_sleep_enable = true;
+    #endif
+    esp_err_t err = esp_pm_configure(&pm);
+    Serial.printf("[POWER] DFS 80-240 MHz, light sleep %s (%s)\n",
+                  pm.light_sleep_enable ? "on" : "off", esp_err_to_name(err));
+    #elif defined(ENABLE_LIGHT_SLEEP)
+    Serial.println("[POWER] Light sleep requested, but CONFIG_PM_ENABLE is off");
+    #endif
+}
+
 void setup() {
     // Serial for debugging
     Serial.begin(115200);
@@ -231,7 +335,28 @@ void setup() {
     // === INITIALIZE SENSOR FILTER & HISTORY ===
     Serial.println("[INIT] Sensor filter & history...");
     sensorFilter.begin();
-    sensorHistory.begin();
+    // Flash commits stall both cores: hold the LVGL lock so no frame
+    // renders or DMA-flushes during a commit
+    sensorHistory.begin(lvgl_lock, lvgl_unlock);
+    sensorQuantiles.begin();
+    exposureTracker.begin();
+    
+    // History charts start with what was loaded from flash
+    feedHistoryCharts(true);
+    
+    #ifdef RUN_BENCHMARKS_ON_BOOT
+    sensorHistory.benchmarkLayout();
+    lvgl_benchmark_flush();
+    lvgl_benchmark_bands();
+    lvgl_benchmark_render_mode();
+    ui_benchmarkLeafSprites();
+    #endif
+    
+    // === LVGL RENDER TASK ===
+    // From here on LVGL is only touched by the render task
+    lvgl_start_task(ui_processMessages);
+    configurePowerManagement();
+    displayPower.begin();
     
     // Initialize timing variables for equidistant intervals
     lastSensorRead = millis();
@@ -250,20 +375,22 @@ void setup() {
 }
 
 void loop() {
-    // === LVGL LOOP (IMPORTANT!) ===
-    // Must be called regularly for UI updates
-    lvgl_loop();
+    // LVGL runs in its own render task (see lvgl_start_task())
     
     // === UI BUTTON CHECK ===
     #ifdef UI_BUTTON_ENABLED
     checkUIButton();
     #endif
     
+    // === SERIAL DEBUG COMMANDS ===
+    checkSerialCommands();
+    
     // === WIFI RECONNECT CHECK ===
     myClock.update();
     
     // === SENSOR HISTORY UPDATE ===
     sensorHistory.update();
+    feedHistoryCharts(false);
     
     // === CONTINUOUS SENSOR READING ===
     // Read PMS5003 continuously (asynchronous)
@@ -276,6 +403,9 @@ void loop() {
         last_radar_ok = millis();
     }
     
+    // === DISPLAY POWER (dim/blank without presence, wake at once) ===
+    displayPower.update(readings.radar, last_radar_ok);
+    
     // === TIME UPDATE (500ms for smooth seconds display) ===
     if (millis() - lastTimeUpdate >= 500) {
         lastTimeUpdate = millis();  // Not equidistant since seconds display is more important
@@ -318,7 +448,8 @@ void loop() {
         // Air quality values to filter
         sensorFilter.addAirMeasurement(readings.mhz.co2_ppm,
                                        readings.sgp.voc_index,
-                                       readings.pms.PM_AE_UG_2_5);
+                                       readings.pms.PM_AE_UG_2_5,
+                                       readings.pms.PM_AE_UG_10_0);
         
         // === PASS VALUES TO HISTORY ===
         sensorHistory.addMeasurement(readings.aht.temperature,
@@ -326,6 +457,11 @@ void loop() {
                                      readings.mhz.co2_ppm,
                                      readings.sgp.voc_index,
                                      readings.pms.PM_AE_UG_2_5);
+        
+        // === PASS RAW VALUES TO QUANTILE SKETCHES ===
+        sensorQuantiles.addSample(readings.mhz.co2_ppm,
+                                  readings.pms.PM_AE_UG_2_5,
+                                  readings.sgp.voc_index);
     }
     
     // === DISPLAY UPDATE (SMOOTHED) ===
@@ -355,6 +491,7 @@ void loop() {
             sensorFilter.getSmoothedHum(),
             sensorFilter.getSmoothedCO2(),
             sensorFilter.getSmoothedPM25(),
+            sensorFilter.getSmoothedPM10(),
             sensorFilter.getSmoothedVOC()
         );
     }
@@ -377,8 +514,16 @@ void loop() {
                       sensorFilter.getSmoothedVOC(),
                       sensorFilter.getSmoothedPM25());
         Serial.printf("[HISTORY]  Entries: %d\n", sensorHistory.getEntryCount());
+        Serial.printf("[EXPOSURE] PM2.5 24h: %.1f CO2 8h TWA: %.0f CO2>%d: %lu min/24h\n",
+                      exposureTracker.getPM25Mean24h(),
+                      exposureTracker.getCO2Twa8h(),
+                      LIMIT_CO2_MODERATE,
+                      (unsigned long)exposureTracker.getMinutesAbove(EXPO_24H, EXPO_CO2, EXPO_ABOVE_MODERATE));
+        displayPower.printStatus();
+        lvgl_print_stats();
+        ui_printMemory();
     }
     
-    // Give CPU time to FreeRTOS tasks
-    yield();
+    // Give CPU time to FreeRTOS tasks (and the idle task)
+    delay(LOOP_IDLE_MS);
 }
@@ -0,0 +1,210 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - AIR QUALITY INDEX ENGINE
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Single source for every status the screens show. One call classifies all
+ * channels of a sensor update; the UI caches the result and every widget
+ * reads from it instead of comparing against the limits itself.
+ *
+ * Pollutants (CO2, PM2.5, PM10, VOC) map onto a common 0-500 index in six
+ * levels (EEA European AQI names, EPA AQI index scale). Each pollutant has a
+ * constexpr breakpoint table; the level is the number of breakpoints a value
+ * reaches (a sum of comparisons, no branches) and the sub-index is linear
+ * within the level. The overall index is the highest sub-index.
+ *
+ * The first three breakpoints are the LIMIT_* values of colors.h, so the
+ * 3-step display status (good / warn / bad) stays what it has always been.
+ * Above them:
+ * - PM2.5 / PM10: EEA bands (poor / very poor / extremely poor)
+ * - CO2: 2000 ppm (UBA: hygienically unacceptable), 5000 ppm (workplace limit)
+ * - VOC: upper part of the Sensirion index range (max. 500)
+ *
+ * Temperature and humidity are comfort channels without an index: two-sided
+ * status plus a severity for sizing, taken from the same cached result.
+ */
+
+#ifndef AQI_ENGINE_H
+#define AQI_ENGINE_H
+
+#include <stdint.h>
+#include "colors.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CHANNELS AND LEVELS
+// ═══════════════════════════════════════════════════════════════════════════
+
+enum AqiChannel : uint8_t {
+    AQI_CO2 = 0,
+    AQI_PM25,
+    AQI_PM10,
+    AQI_VOC,
+    AQI_TEMP,               // Comfort channels (no index)
+    AQI_HUM,
+    AQI_CHANNEL_COUNT
+};
+
+#define AQI_POLLUTANT_COUNT     4       // AQI_CO2 ... AQI_VOC
+
+enum AqiLevel : uint8_t {
+    AQI_LEVEL_GOOD = 0,
+    AQI_LEVEL_FAIR,
+    AQI_LEVEL_MODERATE,
+    AQI_LEVEL_POOR,
+    AQI_LEVEL_VERY_POOR,
+    AQI_LEVEL_EXTREMELY_POOR,
+    AQI_LEVEL_COUNT
+};
+
+// 3-step display status (same values as the UI's Status enum)
+enum AqiStatus : uint8_t { AQI_STATUS_GOOD = 0, AQI_STATUS_WARN = 1, AQI_STATUS_BAD = 2 };
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TABLES
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Index at the start of each level (last entry = top of the scale)
+static constexpr int32_t AQI_INDEX_BOUNDS[AQI_LEVEL_COUNT + 1] = { 0, 50, 100, 150, 200, 300, 500 };
+
+// Display status per level: fair and moderate are "warn", poor and worse "bad"
+static constexpr uint8_t AQI_LEVEL_STATUS[AQI_LEVEL_COUNT] = {
+    AQI_STATUS_GOOD, AQI_STATUS_WARN, AQI_STATUS_WARN,
+    AQI_STATUS_BAD, AQI_STATUS_BAD, AQI_STATUS_BAD
+};
+
+/**
+ * Concentration at which each level starts (integer sensor units), last
+ * entry = top of the scale. Limits that are "≤ x = good" in colors.h start
+ * the next level at x + 1.
+ */
+static constexpr int32_t AQI_BREAKPOINTS[AQI_POLLUTANT_COUNT][AQI_LEVEL_COUNT + 1] = {
+    // CO2 (ppm)
+    { 0, LIMIT_CO2_GOOD, LIMIT_CO2_MODERATE, LIMIT_CO2_BAD, 2000, 5000, 10000 },
+    // PM2.5 (µg/m³)
+    { 0, LIMIT_PM25_GOOD + 1, LIMIT_PM25_MODERATE + 1, LIMIT_PM25_BAD + 1, 51, 76, 800 },
+    // PM10 (µg/m³)
+    { 0, LIMIT_PM10_GOOD + 1, LIMIT_PM10_MODERATE + 1, LIMIT_PM10_BAD + 1, 101, 151, 1200 },
+    // VOC index
+    { 0, LIMIT_VOC_GOOD + 1, LIMIT_VOC_MODERATE + 1, LIMIT_VOC_BAD + 1, 401, 451, 500 },
+};
+
+// Comfort zones; min/max = value at which the severity reaches 1
+struct AqiComfortZone {
+    float goodMin, goodMax;
+    float warnMin, warnMax;
+    float min, max;
+};
+
+static constexpr AqiComfortZone AQI_COMFORT[2] = {
+    { LIMIT_TEMP_GOOD_MIN, LIMIT_TEMP_GOOD_MAX, LIMIT_TEMP_WARN_MIN, LIMIT_TEMP_WARN_MAX, 10, 35 },
+    { LIMIT_HUM_GOOD_MIN, LIMIT_HUM_GOOD_MAX, LIMIT_HUM_WARN_MIN, LIMIT_HUM_WARN_MAX, 20, 80 },
+};
+
+// Levels must be non-empty, otherwise the interpolation divides by zero
+constexpr bool aqi_table_ascending(const int32_t* t, int i) {
+    return i >= AQI_LEVEL_COUNT || (t[i] < t[i + 1] && aqi_table_ascending(t, i + 1));
+}
+
+static_assert(aqi_table_ascending(AQI_INDEX_BOUNDS, 0), "AQI index bounds not ascending");
+static_assert(aqi_table_ascending(AQI_BREAKPOINTS[AQI_CO2], 0), "CO2 breakpoints not ascending");
+static_assert(aqi_table_ascending(AQI_BREAKPOINTS[AQI_PM25], 0), "PM2.5 breakpoints not ascending");
+static_assert(aqi_table_ascending(AQI_BREAKPOINTS[AQI_PM10], 0), "PM10 breakpoints not ascending");
+static_assert(aqi_table_ascending(AQI_BREAKPOINTS[AQI_VOC], 0), "VOC breakpoints not ascending");
+
+// ═══════════════════════════════════════════════════════════════════════════
+// RESULT
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct AqiResult {
+    int16_t index;                              // 0-500, highest sub-index
+    uint8_t level;                              // AqiLevel of the dominant pollutant
+    uint8_t status;                             // AqiStatus of the pollutants together
+    uint8_t dominant;                           // AqiChannel with the highest sub-index
+    int16_t subIndex[AQI_POLLUTANT_COUNT];
+    uint8_t levels[AQI_POLLUTANT_COUNT];
+    uint8_t channelStatus[AQI_CHANNEL_COUNT];   // AqiStatus per channel
+    float severity[AQI_CHANNEL_COUNT];          // 0 = good ... 1 = far outside
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// EVALUATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * Level of a value: number of level breakpoints it reaches
+ */
+inline int aqi_level(AqiChannel pollutant, int32_t value) {
+    const int32_t* bp = AQI_BREAKPOINTS[pollutant];
+    return (value >= bp[1]) + (value >= bp[2]) + (value >= bp[3]) + (value >= bp[4]) + (value >= bp[5]);
+}
+
+/**
+ * Sub-index of a value within its level (linear between the breakpoints)
+ */
+inline int32_t aqi_sub_index(AqiChannel pollutant, int32_t value, int level) {
+    const int32_t* bp = AQI_BREAKPOINTS[pollutant];
+    int32_t top = bp[AQI_LEVEL_COUNT];
+    value = (value < 0) ? 0 : value;
+    value = (value > top) ? top : value;
+    return AQI_INDEX_BOUNDS[level] +
+           (AQI_INDEX_BOUNDS[level + 1] - AQI_INDEX_BOUNDS[level]) * (value - bp[level]) /
+           (bp[level + 1] - bp[level]);
+}
+
+/**
+ * Two-sided comfort status: limits exceeded on the worse side
+ */
+inline int aqi_comfort_status(const AqiComfortZone& z, float value) {
+    int low = (value < z.goodMin) + (value < z.warnMin);
+    int high = (value > z.goodMax) + (value > z.warnMax);
+    return (low > high) ? low : high;
+}
+
+/**
+ * Distance outside the comfort zone (0 inside, 1 at min/max)
+ */
+inline float aqi_comfort_severity(const AqiComfortZone& z, float value) {
+    float s = 0.0f;
+    if (value < z.goodMin) s = (z.goodMin - value) / (z.goodMin - z.min);
+    if (value > z.goodMax) s = (value - z.goodMax) / (z.max - z.goodMax);
+    return (s > 1.0f) ? 1.0f : s;
+}
+
+/**
+ * Classifies one sensor update (all channels)
+ */
+inline AqiResult aqi_evaluate(float temp, float hum, int co2, int pm25, int pm10, int voc) {
+    AqiResult r;
+    const int32_t values[AQI_POLLUTANT_COUNT] = { co2, pm25, pm10, voc };
+
+    r.index = -1;
+    r.level = AQI_LEVEL_GOOD;
+    r.dominant = AQI_CO2;
+    for (int i = 0; i < AQI_POLLUTANT_COUNT; i++) {
+        int level = aqi_level((AqiChannel)i, values[i]);
+        int32_t sub = aqi_sub_index((AqiChannel)i, values[i], level);
+        r.levels[i] = (uint8_t)level;
+        r.subIndex[i] = (int16_t)sub;
+        r.channelStatus[i] = AQI_LEVEL_STATUS[level];
+
+        // Good up to index 50, full size from "very poor" (200) on
+        float s = (sub - AQI_INDEX_BOUNDS[AQI_LEVEL_FAIR]) /
+                  (float)(AQI_INDEX_BOUNDS[AQI_LEVEL_VERY_POOR] - AQI_INDEX_BOUNDS[AQI_LEVEL_FAIR]);
+        r.severity[i] = (s < 0.0f) ? 0.0f : (s > 1.0f) ? 1.0f : s;
+
+        if (sub > r.index) {
+            r.index = (int16_t)sub;
+            r.dominant = (uint8_t)i;
+        }
+        if (level > r.level) r.level = (uint8_t)level;
+    }
+    r.status = AQI_LEVEL_STATUS[r.level];
+
+    r.channelStatus[AQI_TEMP] = (uint8_t)aqi_comfort_status(AQI_COMFORT[0], temp);
+    r.channelStatus[AQI_HUM] = (uint8_t)aqi_comfort_status(AQI_COMFORT[1], hum);
+    r.severity[AQI_TEMP] = aqi_comfort_severity(AQI_COMFORT[0], temp);
+    r.severity[AQI_HUM] = aqi_comfort_severity(AQI_COMFORT[1], hum);
+    return r;
+}
+
+#endif // AQI_ENGINE_H
@@ -0,0 +1,152 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - EXPOSURE TRACKER (rolling 8h / 24h metrics)
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "exposure_tracker.h"
+
+// Global instance
+ExposureTracker exposureTracker;
+
+static const char* const CHANNEL_NAMES[EXPO_CH_COUNT] = { "CO2", "PM2.5", "VOC" };
+
+// AQI pollutant of each exposure channel
+static const AqiChannel AQI_CHANNEL_OF[EXPO_CH_COUNT] = { AQI_CO2, AQI_PM25, AQI_VOC };
+
+static_assert(EXPO_LIMIT_COUNT == AQI_LEVEL_POOR, "Exposure limits must be the first AQI levels");
+
+/**
+ * Number of limits a value is worse than: the AQI level, capped at "poor"
+ * (the first three aqi_engine.h breakpoints are the LIMIT_* values)
+ */
+static int limitsExceeded(ExposureChannel channel, int value) {
+    int level = aqi_level(AQI_CHANNEL_OF[channel], value);
+    return (level < EXPO_LIMIT_COUNT) ? level : EXPO_LIMIT_COUNT;
+}
+
+void ExposureTracker::begin() {
+    windows[EXPO_8H].seconds = EXPOSURE_WINDOW_8H;
+    windows[EXPO_24H].seconds = EXPOSURE_WINDOW_24H;
+
+    // Take over the entries loaded from flash
+    uint32_t total = sensorHistory.getTotalAppended();
+    uint32_t first = total - sensorHistory.getEntryCount();
+    for (int i = 0; i < EXPO_WINDOW_COUNT; i++) {
+        resetWindow(windows[i], first);
+    }
+    HistoryEntry entry;
+    for (uint32_t seq = first; seq < total; seq++) {
+        if (sensorHistory.getEntryBySequence(seq, entry)) {
+            add(entry, seq);
+        }
+    }
+
+    sensorHistory.setAppendListener(onAppend, this);
+    initialized = true;
+
+    Serial.printf("[EXPOSURE] Exposure tracker initialized (%lu minutes in 24h window)\n",
+                  (unsigned long)windows[EXPO_24H].minutes);
+}
+
+void ExposureTracker::onAppend(const HistoryEntry& entry, void* context) {
+    // Called before the entry is written: it gets the next sequence number
+    ((ExposureTracker*)context)->add(entry, sensorHistory.getTotalAppended());
+}
+
+void ExposureTracker::resetWindow(ExposureWindow& w, uint32_t seq) {
+    w.tailSeq = seq;
+    w.minutes = 0;
+    memset(w.sum, 0, sizeof(w.sum));
+    memset(w.above, 0, sizeof(w.above));
+}
+
+void ExposureTracker::apply(ExposureWindow& w, const HistoryEntry& entry, int sign) {
+    const int values[EXPO_CH_COUNT] = { entry.co2, entry.pm25, entry.voc };
+    for (int c = 0; c < EXPO_CH_COUNT; c++) {
+        w.sum[c] += sign * values[c];
+        int exceeded = limitsExceeded((ExposureChannel)c, values[c]);
+        for (int l = 0; l < exceeded; l++) {
+            w.above[c][l] += sign;
+        }
+    }
+    w.minutes += sign;
+}
+
+void ExposureTracker::add(const HistoryEntry& entry, uint32_t seq) {
+    for (int i = 0; i < EXPO_WINDOW_COUNT; i++) {
+        ExposureWindow& w = windows[i];
+
+        // History was cleared, sequence numbers restarted
+        if (w.tailSeq > seq) {
+            resetWindow(w, seq);
+        }
+
+        // Drop entries that left the window. The oldest history slot is
+        // overwritten by this append, so it has to go regardless of age.
+        HistoryEntry old;
+        while (w.tailSeq < seq) {
+            if (!sensorHistory.getEntryBySequence(w.tailSeq, old)) {
+                // History was cleared: start over
+                resetWindow(w, seq);
+                break;
+            }
+            bool expired = (entry.timestamp >= old.timestamp + w.seconds);
+            bool overwritten = (seq - w.tailSeq >= HISTORY_ENTRIES);
+            if (!expired && !overwritten) break;
+
+            apply(w, old, -1);
+            w.tailSeq++;
+        }
+
+        apply(w, entry, +1);
+    }
+}
+
+float ExposureTracker::getMean(ExposureWindowId window, ExposureChannel channel) const {
+    if (!initialized || window >= EXPO_WINDOW_COUNT || channel >= EXPO_CH_COUNT) return 0;
+    const ExposureWindow& w = windows[window];
+    return (w.minutes > 0) ? (float)w.sum[channel] / w.minutes : 0;
+}
+
+uint32_t ExposureTracker::getMinutesAbove(ExposureWindowId window, ExposureChannel channel,
+                                          ExposureLimit limit) const {
+    if (!initialized || window >= EXPO_WINDOW_COUNT || channel >= EXPO_CH_COUNT ||
+        limit >= EXPO_LIMIT_COUNT) {
+        return 0;
+    }
+    return windows[window].above[channel][limit];
+}
+
+uint32_t ExposureTracker::getMinutes(ExposureWindowId window) const {
+    if (!initialized || window >= EXPO_WINDOW_COUNT) return 0;
+    return windows[window].minutes;
+}
+
+float ExposureTracker::getCoverage(ExposureWindowId window) const {
+    if (!initialized || window >= EXPO_WINDOW_COUNT) return 0;
+    return windows[window].minutes * 60.0f / windows[window].seconds;
+}
+
+void ExposureTracker::printStatus() const {
+    if (!initialized) {
+        Serial.println("[EXPOSURE] Not initialized!");
+        return;
+    }
+
+    Serial.println("\n╔═══════════════════════════════════════════════════════════╗");
+    Serial.println("║              EXPOSURE STATUS                              ║");
+    Serial.println("╠═══════════════════════════════════════════════════════════╣");
+    Serial.printf("║ PM2.5 24h mean: %.1f µg/m³ (coverage %.0f%%)\n",
+                  getPM25Mean24h(), getCoverage(EXPO_24H) * 100.0f);
+    Serial.printf("║ CO2 8h TWA: %.0f ppm (coverage %.0f%%)\n",
+                  getCO2Twa8h(), getCoverage(EXPO_8H) * 100.0f);
+    Serial.println("║ Minutes above limit in 24h (good / moderate / bad):");
+    for (int c = 0; c < EXPO_CH_COUNT; c++) {
+        const ExposureWindow& w = windows[EXPO_24H];
+        Serial.printf("║   %-5s %4u / %4u / %4u\n", CHANNEL_NAMES[c],
+                      w.above[c][EXPO_ABOVE_GOOD], w.above[c][EXPO_ABOVE_MODERATE],
+                      w.above[c][EXPO_ABOVE_BAD]);
+    }
+    Serial.println("╚═══════════════════════════════════════════════════════════╝\n");
+}
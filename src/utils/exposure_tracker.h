@@ -0,0 +1,126 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - EXPOSURE TRACKER (rolling 8h / 24h metrics)
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Guideline values are defined over rolling windows (WHO 2021 PM2.5: 24h
+ * mean, workplace CO2: 8h time-weighted average), the display thresholds
+ * only look at the current value. This tracker keeps per window:
+ * - running sums of CO2, PM2.5 and VOC (→ mean / TWA)
+ * - minutes above each LIMIT_* threshold of colors.h
+ *
+ * It is fed by SensorHistory appends: every new per-minute entry is added
+ * and entries that left the window are subtracted (read back from the
+ * history), so each update is O(1) and queries never scan.
+ *
+ * Every entry is a 1-minute average and weighs one minute; minutes without
+ * data (device off) are not counted, see getCoverage().
+ */
+
+#ifndef EXPOSURE_TRACKER_H
+#define EXPOSURE_TRACKER_H
+
+#include <Arduino.h>
+#include "sensor_history.h"
+#include "aqi_engine.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define EXPOSURE_WINDOW_8H      (8UL * 3600)    // Workplace TWA (seconds)
+#define EXPOSURE_WINDOW_24H     (24UL * 3600)   // WHO daily mean (seconds)
+
+// ═══════════════════════════════════════════════════════════════════════════
+// IDS
+// ═══════════════════════════════════════════════════════════════════════════
+
+enum ExposureWindowId : uint8_t {
+    EXPO_8H = 0,
+    EXPO_24H,
+    EXPO_WINDOW_COUNT
+};
+
+enum ExposureChannel : uint8_t {
+    EXPO_CO2 = 0,           // CO2 in ppm
+    EXPO_PM25,              // PM2.5 in µg/m³
+    EXPO_VOC,               // VOC index
+    EXPO_CH_COUNT
+};
+
+enum ExposureLimit : uint8_t {
+    EXPO_ABOVE_GOOD = 0,    // Worse than LIMIT_*_GOOD
+    EXPO_ABOVE_MODERATE,    // Worse than LIMIT_*_MODERATE
+    EXPO_ABOVE_BAD,         // Worse than LIMIT_*_BAD
+    EXPO_LIMIT_COUNT
+};
+
+/**
+ * Running state of one rolling window
+ */
+struct ExposureWindow {
+    uint32_t seconds;                               // Window length
+    uint32_t tailSeq;                               // Oldest entry in window
+    uint32_t minutes;                               // Entries in window
+    uint32_t sum[EXPO_CH_COUNT];
+    uint16_t above[EXPO_CH_COUNT][EXPO_LIMIT_COUNT];
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// EXPOSURE TRACKER CLASS
+// ═══════════════════════════════════════════════════════════════════════════
+
+class ExposureTracker {
+private:
+    ExposureWindow windows[EXPO_WINDOW_COUNT];
+    bool initialized = false;
+
+    void resetWindow(ExposureWindow& w, uint32_t seq);
+    void apply(ExposureWindow& w, const HistoryEntry& entry, int sign);
+    void add(const HistoryEntry& entry, uint32_t seq);
+    static void onAppend(const HistoryEntry& entry, void* context);
+
+public:
+    /**
+     * Initialization: takes over the entries already in the history and
+     * registers for new ones (call after sensorHistory.begin())
+     */
+    void begin();
+
+    /**
+     * Time-weighted mean of a channel over a window (0 if no data)
+     */
+    float getMean(ExposureWindowId window, ExposureChannel channel) const;
+
+    /**
+     * Minutes within a window where a channel was worse than a limit
+     */
+    uint32_t getMinutesAbove(ExposureWindowId window, ExposureChannel channel,
+                             ExposureLimit limit) const;
+
+    /**
+     * Minutes with data in a window
+     */
+    uint32_t getMinutes(ExposureWindowId window) const;
+
+    /**
+     * Share of the window covered by data (0.0 ... 1.0)
+     */
+    float getCoverage(ExposureWindowId window) const;
+
+    /**
+     * Shortcuts for the guideline metrics
+     */
+    float getPM25Mean24h() const { return getMean(EXPO_24H, EXPO_PM25); }
+    float getCO2Twa8h() const { return getMean(EXPO_8H, EXPO_CO2); }
+
+    /**
+     * Debug output
+     */
+    void printStatus() const;
+};
+
+// Global instance
+extern ExposureTracker exposureTracker;
+
+#endif // EXPOSURE_TRACKER_H
@@ -0,0 +1,221 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - INCREMENTAL LTTB DECIMATOR
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Reduces a time series to one point per time bucket with
+ * Largest-Triangle-Three-Buckets: from every bucket the sample is kept that
+ * spans the largest triangle with the point kept before it and the average
+ * of the next bucket, so peaks survive where plain averaging flattens them.
+ *
+ * Buckets are aligned to absolute time (timestamp / bucketSeconds), which
+ * makes the decimation incremental: a new sample can only close the bucket
+ * before the open one. Each closed bucket writes one point at the head of
+ * caller-owned rings (one per channel, e.g. lv_chart external arrays),
+ * nothing older is ever recomputed.
+ *
+ * The kept point of a bucket depends on the next bucket, so the two newest
+ * buckets are still open and the rings lag behind by up to two buckets.
+ */
+
+#ifndef LTTB_DECIMATOR_H
+#define LTTB_DECIMATOR_H
+
+#include <Arduino.h>
+#include <math.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define LTTB_BUCKET_SAMPLES     32          // Max. samples per open bucket
+#define LTTB_NO_VALUE           INT32_MAX   // Empty ring slot (= LV_CHART_POINT_NONE)
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DECIMATOR TEMPLATE (CHANNELS = values per sample, decimated independently)
+// ═══════════════════════════════════════════════════════════════════════════
+
+template<int CHANNELS>
+class LttbDecimator {
+private:
+    struct Bucket {
+        uint32_t index;                         // timestamp / bucketSeconds
+        int count;
+        uint32_t t[LTTB_BUCKET_SAMPLES];
+        float v[CHANNELS][LTTB_BUCKET_SAMPLES];
+    };
+
+    uint32_t bucketSeconds = 60;
+    int capacity = 0;
+    int32_t* rings[CHANNELS] = {};
+    int head = 0;                   // Next write slot (= oldest point once full)
+    uint32_t newestIndex = 0;       // Bucket of the newest ring point
+    bool hasPoints = false;
+
+    // Kept point of the last closed bucket, per channel
+    uint32_t anchorT[CHANNELS];
+    float anchorV[CHANNELS];
+
+    // buckets[pendingSlot] waits for the next bucket, the other one collects
+    Bucket buckets[2];
+    int pendingSlot = 0;
+    bool hasPending = false;
+    bool hasOpen = false;
+
+    Bucket& pending() { return buckets[pendingSlot]; }
+    Bucket& open() { return buckets[pendingSlot ^ 1]; }
+
+    static void startBucket(Bucket& b, uint32_t index) {
+        b.index = index;
+        b.count = 0;
+    }
+
+    static void addSample(Bucket& b, uint32_t t, const float* values) {
+        if (b.count >= LTTB_BUCKET_SAMPLES) return;    // Denser input than planned
+        b.t[b.count] = t;
+        for (int ch = 0; ch < CHANNELS; ch++) {
+            b.v[ch][b.count] = values[ch];
+        }
+        b.count++;
+    }
+
+    void writeSlot(int ch, int32_t value) {
+        rings[ch][head] = value;
+    }
+
+    void advance() {
+        head = (head + 1) % capacity;
+    }
+
+    // Empty slots for buckets without samples (device off)
+    int fillGap(uint32_t index) {
+        if (!hasPoints) return 0;
+        uint32_t missing = index - newestIndex - 1;
+        if (missing > (uint32_t)capacity) missing = capacity;
+        for (uint32_t i = 0; i < missing; i++) {
+            for (int ch = 0; ch < CHANNELS; ch++) {
+                writeSlot(ch, LTTB_NO_VALUE);
+            }
+            advance();
+        }
+        return (int)missing;
+    }
+
+    // Keeps one sample per channel of the pending bucket
+    int closePending() {
+        Bucket& b = pending();
+        const Bucket& c = open();
+        int written = fillGap(b.index);
+
+        for (int ch = 0; ch < CHANNELS; ch++) {
+            int best = 0;
+            if (hasPoints) {
+                // Coordinates relative to the anchor (a = origin); c = average
+                // of the next bucket. Twice the triangle area = |b x c|.
+                float cx = 0, cy = 0;
+                for (int i = 0; i < c.count; i++) {
+                    cx += (float)(int32_t)(c.t[i] - anchorT[ch]);
+                    cy += c.v[ch][i];
+                }
+                cx /= c.count;
+                cy = cy / c.count - anchorV[ch];
+
+                float bestArea = -1;
+                for (int i = 0; i < b.count; i++) {
+                    float bx = (float)(int32_t)(b.t[i] - anchorT[ch]);
+                    float by = b.v[ch][i] - anchorV[ch];
+                    float area = fabsf(bx * cy - cx * by);
+                    if (area > bestArea) {
+                        bestArea = area;
+                        best = i;
+                    }
+                }
+            }
+            anchorT[ch] = b.t[best];
+            anchorV[ch] = b.v[ch][best];
+            writeSlot(ch, (int32_t)lroundf(anchorV[ch]));
+        }
+        advance();
+
+        newestIndex = b.index;
+        hasPoints = true;
+        return written + 1;
+    }
+
+public:
+    /**
+     * Attaches the output rings and clears them
+     * @param bucketSeconds Time span of one output point
+     * @param capacity Points per ring
+     * @param outRings One ring of `capacity` values per channel
+     */
+    void begin(uint32_t bucketSeconds, int capacity, int32_t* const* outRings) {
+        this->bucketSeconds = bucketSeconds;
+        this->capacity = capacity;
+        for (int ch = 0; ch < CHANNELS; ch++) {
+            rings[ch] = outRings[ch];
+            for (int i = 0; i < capacity; i++) {
+                rings[ch][i] = LTTB_NO_VALUE;
+            }
+        }
+        head = 0;
+        hasPoints = false;
+        hasPending = false;
+        hasOpen = false;
+    }
+
+    /**
+     * Adds a sample (one value per channel). Samples must arrive in time
+     * order, older ones than the open bucket are ignored.
+     * @return Number of ring points written (0 = rings unchanged)
+     */
+    int add(uint32_t timestamp, const float* values) {
+        if (capacity == 0) return 0;
+        uint32_t index = timestamp / bucketSeconds;
+
+        if (hasOpen) {
+            if (index < open().index) return 0;
+            if (index == open().index) {
+                addSample(open(), timestamp, values);
+                return 0;
+            }
+            int written = closePending();
+            pendingSlot ^= 1;
+            startBucket(open(), index);
+            addSample(open(), timestamp, values);
+            return written;
+        }
+
+        if (hasPending) {
+            if (index < pending().index) return 0;
+            if (index == pending().index) {
+                addSample(pending(), timestamp, values);
+                return 0;
+            }
+            startBucket(open(), index);
+            addSample(open(), timestamp, values);
+            hasOpen = true;
+            return 0;
+        }
+
+        startBucket(pending(), index);
+        addSample(pending(), timestamp, values);
+        hasPending = true;
+        return 0;
+    }
+
+    /**
+     * Ring index of the oldest point (left chart edge)
+     */
+    int getHead() const { return head; }
+
+    /**
+     * Ring index of the newest point, -1 if none was written yet
+     */
+    int getNewest() const { return hasPoints ? (head + capacity - 1) % capacity : -1; }
+
+    int getCapacity() const { return capacity; }
+    uint32_t getBucketSeconds() const { return bucketSeconds; }
+};
+
+#endif // LTTB_DECIMATOR_H
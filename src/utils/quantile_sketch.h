@@ -0,0 +1,140 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - STREAMING QUANTILE SKETCH
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Fixed-memory quantile estimate over an unbounded sample stream.
+ *
+ * Samples are counted in logarithmic buckets (bucket i covers
+ * [GAMMA^(i-1), GAMMA^i)), so every quantile is returned with a bounded
+ * relative error of about (GAMMA - 1) / 2 ≈ 3.6%. Unlike P² or KLL the
+ * state is just a count vector, so two sketches merge exactly by adding
+ * counts - a day sketch built from 24 hourly sketches is identical to one
+ * fed with all samples of the day.
+ *
+ * Range: 0 (bucket 0 = values below 1) up to ~9800, larger values land in
+ * the last bucket (quantiles there are clamped to the exact maximum).
+ */
+
+#ifndef QUANTILE_SKETCH_H
+#define QUANTILE_SKETCH_H
+
+#include <Arduino.h>
+#include <math.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define SKETCH_BUCKETS          128     // Bucket count (incl. zero bucket)
+#define SKETCH_GAMMA            1.075f  // Bucket growth factor
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SKETCH TEMPLATE (COUNT_T = counter type, uint16_t is enough for 1h @ 2s)
+// ═══════════════════════════════════════════════════════════════════════════
+
+template<typename COUNT_T>
+class QuantileSketch {
+private:
+    COUNT_T buckets[SKETCH_BUCKETS];
+    uint32_t count = 0;
+    float sum = 0;
+    float minValue = 0;
+    float maxValue = 0;
+
+    static int bucketOf(float value) {
+        if (value < 1.0f) return 0;
+        int i = 1 + (int)(logf(value) / logf(SKETCH_GAMMA));
+        return (i < SKETCH_BUCKETS) ? i : SKETCH_BUCKETS - 1;
+    }
+
+    // Value in the (relative) middle of a bucket
+    static float bucketValue(int i) {
+        if (i == 0) return 0;
+        return powf(SKETCH_GAMMA, (float)(i - 1)) * (1.0f + SKETCH_GAMMA) * 0.5f;
+    }
+
+    void addCount(int i, uint32_t n) {
+        // Saturate instead of wrapping around
+        uint32_t c = (uint32_t)buckets[i] + n;
+        const uint32_t limit = (COUNT_T)~(COUNT_T)0;
+        buckets[i] = (COUNT_T)((c > limit) ? limit : c);
+    }
+
+public:
+    QuantileSketch() { reset(); }
+
+    void reset() {
+        for (int i = 0; i < SKETCH_BUCKETS; i++) {
+            buckets[i] = 0;
+        }
+        count = 0;
+        sum = 0;
+        minValue = 0;
+        maxValue = 0;
+    }
+
+    void add(float value) {
+        if (value < 0) value = 0;
+        addCount(bucketOf(value), 1);
+        if (count == 0 || value < minValue) minValue = value;
+        if (count == 0 || value > maxValue) maxValue = value;
+        sum += value;
+        count++;
+    }
+
+    /**
+     * Adds all samples of another sketch (exact, any counter type)
+     */
+    template<typename OTHER_T>
+    void merge(const QuantileSketch<OTHER_T>& other) {
+        if (other.getCount() == 0) return;
+        for (int i = 0; i < SKETCH_BUCKETS; i++) {
+            if (other.bucketCount(i) > 0) {
+                addCount(i, other.bucketCount(i));
+            }
+        }
+        if (count == 0 || other.getMin() < minValue) minValue = other.getMin();
+        if (count == 0 || other.getMax() > maxValue) maxValue = other.getMax();
+        sum += other.getSum();
+        count += other.getCount();
+    }
+
+    /**
+     * Returns the estimated q-quantile (q = 0.0 ... 1.0), 0 if empty
+     */
+    float quantile(float q) const {
+        if (count == 0) return 0;
+        if (q <= 0) return minValue;
+        if (q >= 1) return maxValue;
+
+        // Rank of the wanted sample (0-based)
+        uint32_t rank = (uint32_t)(q * (count - 1) + 0.5f);
+        uint32_t seen = 0;
+        for (int i = 0; i < SKETCH_BUCKETS; i++) {
+            seen += buckets[i];
+            if (seen > rank) {
+                float v = bucketValue(i);
+                if (v < minValue) return minValue;
+                if (v > maxValue) return maxValue;
+                return v;
+            }
+        }
+        return maxValue;
+    }
+
+    uint32_t getCount() const { return count; }
+    uint32_t bucketCount(int i) const { return buckets[i]; }
+    float getSum() const { return sum; }
+    float getMin() const { return minValue; }
+    float getMax() const { return maxValue; }
+    float getMean() const { return (count > 0) ? sum / count : 0; }
+};
+
+// Hourly sketch: 1800 samples @ 2s fit into 16-bit counters
+typedef QuantileSketch<uint16_t> HourSketch;
+
+// Merged sketch over several hours
+typedef QuantileSketch<uint32_t> DaySketch;
+
+#endif // QUANTILE_SKETCH_H
@@ -16,6 +16,7 @@ void SensorFilter::begin() {
     co2Buffer.reset();
     vocBuffer.reset();
     pm25Buffer.reset();
+    pm10Buffer.reset();
     
     // Initialize timing
     lastClimateMeasure = 0;
@@ -29,6 +30,7 @@ void SensorFilter::begin() {
     displayCO2 = 0;
     displayVOC = 0;
     displayPM25 = 0;
+    displayPM10 = 0;
     
     Serial.println("[FILTER] Sensor filter initialized");
     Serial.printf("         Climate: measure every %ds, display every %ds\n", 
@@ -54,7 +56,7 @@ void SensorFilter::addClimateMeasurement(float temp, float humidity) {
     }
 }
 
-void SensorFilter::addAirMeasurement(int32_t co2, int32_t voc, int32_t pm25) {
+void SensorFilter::addAirMeasurement(int32_t co2, int32_t voc, int32_t pm25, int32_t pm10) {
     unsigned long now = millis();
     
     // Check if measurement interval reached
@@ -65,6 +67,7 @@ void SensorFilter::addAirMeasurement(int32_t co2, int32_t voc, int32_t pm25) {
         co2Buffer.add(co2);
         vocBuffer.add(voc);
         pm25Buffer.add(pm25);
+        pm10Buffer.add(pm10);
         
         // Debug (optional)
         // Serial.printf("[FILTER] Air: CO2=%ld VOC=%ld PM=%ld (Samples: %d)\n", 
@@ -104,6 +107,7 @@ bool SensorFilter::shouldUpdateAirDisplay() {
             displayCO2 = co2Buffer.getAverage();
             displayVOC = vocBuffer.getAverage();
             displayPM25 = pm25Buffer.getAverage();
+            displayPM10 = pm10Buffer.getAverage();
             
             return true;
         }
@@ -117,6 +121,7 @@ void SensorFilter::fillSmoothedReadings(SensorReadings& readings) {
     readings.mhz.co2_ppm = displayCO2;
     readings.sgp.voc_index = displayVOC;
     readings.pms.PM_AE_UG_2_5 = displayPM25;
+    readings.pms.PM_AE_UG_10_0 = displayPM10;
 }
 
 void SensorFilter::printStatus() {
@@ -138,5 +143,8 @@ void SensorFilter::printStatus() {
     Serial.printf("║ PM2.5:       Raw=%ld    Avg=%ld    (%d/%d Samples)      \n",
                   pm25Buffer.getLatest(), pm25Buffer.getAverage(),
                   pm25Buffer.getCount(), BUFFER_SIZE_AIR);
+    Serial.printf("║ PM10:        Raw=%ld    Avg=%ld    (%d/%d Samples)      \n",
+                  pm10Buffer.getLatest(), pm10Buffer.getAverage(),
+                  pm10Buffer.getCount(), BUFFER_SIZE_AIR);
     Serial.println("╚═══════════════════════════════════════════════════════════╝\n");
 }
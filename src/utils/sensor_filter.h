@@ -114,6 +114,7 @@ private:
     RingBuffer<int32_t, BUFFER_SIZE_AIR> co2Buffer;
     RingBuffer<int32_t, BUFFER_SIZE_AIR> vocBuffer;
     RingBuffer<int32_t, BUFFER_SIZE_AIR> pm25Buffer;
+    RingBuffer<int32_t, BUFFER_SIZE_AIR> pm10Buffer;
     
     // Timing for measurements
     unsigned long lastClimateMeasure = 0;
@@ -129,6 +130,7 @@ private:
     int32_t displayCO2 = 0;
     int32_t displayVOC = 0;
     int32_t displayPM25 = 0;
+    int32_t displayPM10 = 0;
     
     // Flags for display update notification
     bool climateNeedsUpdate = false;
@@ -145,7 +147,7 @@ public:
      * Internally filtered based on interval
      */
     void addClimateMeasurement(float temp, float humidity);
-    void addAirMeasurement(int32_t co2, int32_t voc, int32_t pm25);
+    void addAirMeasurement(int32_t co2, int32_t voc, int32_t pm25, int32_t pm10);
     
     /**
      * Checks if a display update is needed
@@ -161,6 +163,7 @@ public:
     int32_t getSmoothedCO2() const { return displayCO2; }
     int32_t getSmoothedVOC() const { return displayVOC; }
     int32_t getSmoothedPM25() const { return displayPM25; }
+    int32_t getSmoothedPM10() const { return displayPM10; }
     
     /**
      * Returns current raw values (for debugging)
@@ -170,6 +173,7 @@ public:
     int32_t getRawCO2() const { return co2Buffer.getLatest(); }
     int32_t getRawVOC() const { return vocBuffer.getLatest(); }
     int32_t getRawPM25() const { return pm25Buffer.getLatest(); }
+    int32_t getRawPM10() const { return pm10Buffer.getLatest(); }
     
     /**
      * Fills a SensorReadings struct with smoothed values
@@ -10,20 +10,125 @@
 // Global instance
 SensorHistory sensorHistory;
 
-bool SensorHistory::begin() {
+// ═══════════════════════════════════════════════════════════════════════════
+// COLUMN HELPERS (ring segments: [start, end of array) + [0, rest))
+// ═══════════════════════════════════════════════════════════════════════════
+
+template<typename T>
+static int64_t sumColumn(const T* col, int start, int n) {
+    int64_t sum = 0;
+    int first = min(n, HISTORY_ENTRIES - start);
+    for (int i = 0; i < first; i++) sum += col[start + i];
+    for (int i = 0; i < n - first; i++) sum += col[i];
+    return sum;
+}
+
+template<typename T>
+static void minMaxColumn(const T* col, int start, int n, T& lo, T& hi) {
+    lo = hi = col[start];
+    int first = min(n, HISTORY_ENTRIES - start);
+    for (int i = 0; i < first; i++) {
+        T v = col[start + i];
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    for (int i = 0; i < n - first; i++) {
+        T v = col[i];
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+}
+
+template<typename T>
+static void copyColumn(const T* col, int start, int n, float scale, float* out) {
+    int first = min(n, HISTORY_ENTRIES - start);
+    for (int i = 0; i < first; i++) out[i] = col[start + i] * scale;
+    for (int i = 0; i < n - first; i++) out[first + i] = col[i] * scale;
+}
+
+// Total size of all columns (timestamps first for 4-byte alignment)
+static const size_t STORAGE_SIZE = HISTORY_ENTRIES * (sizeof(uint32_t) + 4 * sizeof(uint16_t) + sizeof(uint8_t));
+
+bool SensorHistory::allocateStorage() {
+    // Prefer PSRAM, fall back to internal RAM
+    storage = heap_caps_malloc(STORAGE_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    storageInPsram = (storage != nullptr);
+    if (storage == nullptr) {
+        storage = heap_caps_malloc(STORAGE_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (storage == nullptr) {
+        return false;
+    }
+    memset(storage, 0, STORAGE_SIZE);
+    
+    uint8_t* p = (uint8_t*)storage;
+    colTimestamp = (uint32_t*)p;  p += HISTORY_ENTRIES * sizeof(uint32_t);
+    colTemp = (int16_t*)p;        p += HISTORY_ENTRIES * sizeof(int16_t);
+    colCO2 = (uint16_t*)p;        p += HISTORY_ENTRIES * sizeof(uint16_t);
+    colPM25 = (uint16_t*)p;       p += HISTORY_ENTRIES * sizeof(uint16_t);
+    colVOC = (uint16_t*)p;        p += HISTORY_ENTRIES * sizeof(uint16_t);
+    colHum = p;
+    return true;
+}
+
+void SensorHistory::freeStorage() {
+    heap_caps_free(storage);
+    storage = nullptr;
+    colTimestamp = nullptr;
+    colTemp = nullptr;
+    colCO2 = nullptr;
+    colPM25 = nullptr;
+    colVOC = nullptr;
+    colHum = nullptr;
+}
+
+void SensorHistory::writeSlot(int slot, const HistoryEntry& entry) {
+    colTimestamp[slot] = entry.timestamp;
+    colTemp[slot] = entry.temp_x10;
+    colHum[slot] = entry.humidity;
+    colCO2[slot] = entry.co2;
+    colPM25[slot] = entry.pm25;
+    colVOC[slot] = entry.voc;
+}
+
+void SensorHistory::readSlot(int slot, HistoryEntry& entry) const {
+    entry.timestamp = colTimestamp[slot];
+    entry.temp_x10 = colTemp[slot];
+    entry.humidity = colHum[slot];
+    entry.co2 = colCO2[slot];
+    entry.pm25 = colPM25[slot];
+    entry.voc = colVOC[slot];
+    entry.reserved = 0;
+}
+
+int SensorHistory::physicalIndex(int index) const {
+    // Index 0 = oldest entry
+    return (head - count + index + HISTORY_ENTRIES) % HISTORY_ENTRIES;
+}
+
+bool SensorHistory::begin(void (*lock)(void), void (*unlock)(void)) {
+    // Installed before the writer task can run its first commit
+    commitLock = lock;
+    commitUnlock = unlock;
+    
+    if (prefsMutex == nullptr) {
+        prefsMutex = xSemaphoreCreateMutex();
+    }
+    
     // Allocate memory (only once!)
-    if (history == nullptr) {
-        history = new HistoryEntry[HISTORY_ENTRIES];
-        if (history == nullptr) {
+    if (storage == nullptr) {
+        if (!allocateStorage()) {
             Serial.println("[HISTORY] ERROR: Could not allocate memory!");
             return false;
         }
-        // Initialize memory
-        memset(history, 0, sizeof(HistoryEntry) * HISTORY_ENTRIES);
     }
     
     head = 0;
     count = 0;
+    timeSynced = false;
+    pendingUptime = 0;
+    timeShift = 0;
+    hasStampMs = false;
     
     // Reset accumulators
     tempSum = 0;
@@ -39,24 +144,33 @@ bool SensorHistory::begin() {
     
     // Try to load stored data
     loadFromFlash();
+    totalAppended = count;
     
     initialized = true;
     
+    // Start background flash writer (once)
+    if (writerTask == nullptr) {
+        if (xTaskCreatePinnedToCore(writerTaskEntry, "hist_writer", HISTORY_WRITER_STACK, this,
+                                    HISTORY_WRITER_PRIORITY, &writerTask, HISTORY_WRITER_CORE) != pdPASS) {
+            writerTask = nullptr;
+            Serial.println("[HISTORY] WARNING: Writer task not started, committing inline");
+        }
+    }
+    
     Serial.println("[HISTORY] Sensor history initialized");
-    Serial.printf("          Memory: %d entries of %d bytes = %d KB\n",
-                  HISTORY_ENTRIES, sizeof(HistoryEntry),
-                  (HISTORY_ENTRIES * sizeof(HistoryEntry)) / 1024);
+    Serial.printf("          Memory: %d entries, %d KB columnar in %s\n",
+                  HISTORY_ENTRIES, (int)(STORAGE_SIZE / 1024),
+                  storageInPsram ? "PSRAM" : "internal RAM");
     Serial.printf("          Loaded entries: %d\n", count);
     
     return true;
 }
 
 void SensorHistory::end() {
-    if (history != nullptr) {
-        // Save before ending
+    if (storage != nullptr) {
+        // Save before ending (the snapshot does not reference the columns)
         saveToFlash();
-        delete[] history;
-        history = nullptr;
+        freeStorage();
     }
     initialized = false;
 }
@@ -84,7 +198,7 @@ void SensorHistory::update() {
         
         // Calculate average
         HistoryEntry entry;
-        entry.timestamp = now / 1000;  // Seconds since boot (or Unix time if available)
+        entry.timestamp = normalizedTimestamp(now);
         entry.temp_x10 = (int16_t)((tempSum / sampleCount) * 10);
         entry.humidity = (uint8_t)(humSum / sampleCount);
         entry.co2 = (uint16_t)(co2Sum / sampleCount);
@@ -92,19 +206,20 @@ void SensorHistory::update() {
         entry.pm25 = (uint16_t)(pm25Sum / sampleCount);
         entry.reserved = 0;
         
-        // Use Unix timestamp if available
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo)) {
-            time_t t = mktime(&timeinfo);
-            entry.timestamp = (uint32_t)t;
+        if (appendListener != nullptr) {
+            appendListener(entry, appendContext);
         }
         
         // Store in ring buffer
-        history[head] = entry;
+        writeSlot(head, entry);
         head = (head + 1) % HISTORY_ENTRIES;
         if (count < HISTORY_ENTRIES) {
             count++;
         }
+        totalAppended++;
+        if (!timeSynced) {
+            pendingUptime = min(pendingUptime + 1, count);
+        }
         
         // Reset accumulators
         tempSum = 0;
@@ -126,52 +241,140 @@ void SensorHistory::update() {
     }
 }
 
-void SensorHistory::saveToFlash() {
-    if (!initialized || count == 0) return;
+void SensorHistory::fillSnapshot(HistorySnapshot& snap) const {
+    snap.head = head;
+    snap.count = count;
+    
+    // Only save the latest 60 entries (1h) to flash
+    // (Full 24h would cause too much flash wear)
+    snap.saved = min(count, HISTORY_FLASH_ENTRIES);
+    int first = count - snap.saved;
+    for (int i = 0; i < snap.saved; i++) {
+        readSlot(physicalIndex(first + i), snap.entries[i]);
+    }
+}
+
+void SensorHistory::commitSnapshot(const HistorySnapshot& snap) {
+    // Wait until no frame renders or flushes, and keep the next one from
+    // starting until the commit is done
+    unsigned long waitStart = millis();
+    if (commitLock != nullptr) commitLock();
+    uint32_t deferMs = millis() - waitStart;
+    
+    xSemaphoreTake(prefsMutex, portMAX_DELAY);
+    
+    // Flash writes disable the cache: both cores stall for this duration
+    unsigned long t0 = micros();
     
     prefs.begin("sensorhist", false);
     
     // Save metadata
-    prefs.putInt("head", head);
-    prefs.putInt("count", count);
-    
-    // Only save the latest 60 entries (1h) to flash
-    // (Full 24h would cause too much flash wear)
-    int saveCount = min(count, 60);
-    int startIdx = (head - saveCount + HISTORY_ENTRIES) % HISTORY_ENTRIES;
+    prefs.putInt("head", snap.head);
+    prefs.putInt("count", snap.count);
     
     // Save as blob
-    HistoryEntry tempBuffer[60];
-    for (int i = 0; i < saveCount; i++) {
-        int idx = (startIdx + i) % HISTORY_ENTRIES;
-        tempBuffer[i] = history[idx];
+    prefs.putBytes("data", snap.entries, snap.saved * sizeof(HistoryEntry));
+    prefs.putInt("saved", snap.saved);
+    
+    prefs.end();
+    
+    uint32_t stallUs = micros() - t0;
+    xSemaphoreGive(prefsMutex);
+    if (commitUnlock != nullptr) commitUnlock();
+    
+    portENTER_CRITICAL(&snapshotLock);
+    commitStats.commits++;
+    commitStats.lastStallUs = stallUs;
+    commitStats.totalStallUs += stallUs;
+    if (stallUs > commitStats.maxStallUs) {
+        commitStats.maxStallUs = stallUs;
+    }
+    commitStats.lastDeferMs = deferMs;
+    if (deferMs > commitStats.maxDeferMs) {
+        commitStats.maxDeferMs = deferMs;
     }
+    portEXIT_CRITICAL(&snapshotLock);
     
-    prefs.putBytes("data", tempBuffer, saveCount * sizeof(HistoryEntry));
-    prefs.putInt("saved", saveCount);
+    // Serial.printf("[HISTORY] %d entries saved to flash (%lu us)\n", snap.saved, stallUs);
+}
+
+void SensorHistory::saveToFlash() {
+    if (!initialized || count == 0) return;
     
-    prefs.end();
+    if (writerTask == nullptr) {
+        // No writer task: commit inline
+        fillSnapshot(snapshots[0]);
+        commitSnapshot(snapshots[0]);
+        return;
+    }
+    
+    // Withdraw an unclaimed snapshot and never touch the one being written
+    portENTER_CRITICAL(&snapshotLock);
+    pendingSnapshot = -1;
+    int idx = (busySnapshot == 0) ? 1 : 0;
+    portEXIT_CRITICAL(&snapshotLock);
+    
+    fillSnapshot(snapshots[idx]);
+    
+    portENTER_CRITICAL(&snapshotLock);
+    pendingSnapshot = idx;
+    portEXIT_CRITICAL(&snapshotLock);
     
-    // Serial.printf("[HISTORY] %d entries saved to flash\n", saveCount);
+    xTaskNotifyGive(writerTask);
+}
+
+void SensorHistory::runPendingCommit() {
+    // Claim the pending snapshot
+    portENTER_CRITICAL(&snapshotLock);
+    int idx = pendingSnapshot;
+    pendingSnapshot = -1;
+    busySnapshot = idx;
+    portEXIT_CRITICAL(&snapshotLock);
+    
+    if (idx < 0) return;
+    
+    commitSnapshot(snapshots[idx]);
+    
+    portENTER_CRITICAL(&snapshotLock);
+    busySnapshot = -1;
+    portEXIT_CRITICAL(&snapshotLock);
+}
+
+HistoryCommitStats SensorHistory::getCommitStats() const {
+    portENTER_CRITICAL(&snapshotLock);
+    HistoryCommitStats stats = commitStats;
+    portEXIT_CRITICAL(&snapshotLock);
+    return stats;
+}
+
+void SensorHistory::writerTaskEntry(void* arg) {
+    SensorHistory* self = (SensorHistory*)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->runPendingCommit();
+    }
 }
 
 void SensorHistory::loadFromFlash() {
     prefs.begin("sensorhist", true);  // read-only
     
     int savedCount = prefs.getInt("saved", 0);
-    if (savedCount > 0 && savedCount <= 60) {
-        HistoryEntry tempBuffer[60];
+    if (savedCount > 0 && savedCount <= HISTORY_FLASH_ENTRIES) {
+        HistoryEntry tempBuffer[HISTORY_FLASH_ENTRIES];
         size_t readBytes = prefs.getBytes("data", tempBuffer, savedCount * sizeof(HistoryEntry));
         
         if (readBytes == savedCount * sizeof(HistoryEntry)) {
-            // Load data into ring buffer
+            // Load data into ring buffer. Entries stamped with the uptime
+            // of a previous boot cannot be placed on the time axis.
+            int loaded = 0;
             for (int i = 0; i < savedCount; i++) {
-                history[i] = tempBuffer[i];
+                if (tempBuffer[i].timestamp < HISTORY_UNIX_MIN) continue;
+                writeSlot(loaded++, tempBuffer[i]);
             }
-            head = savedCount % HISTORY_ENTRIES;
-            count = savedCount;
+            head = loaded % HISTORY_ENTRIES;
+            count = loaded;
             
-            Serial.printf("[HISTORY] %d entries loaded from flash\n", savedCount);
+            Serial.printf("[HISTORY] %d of %d entries loaded from flash\n", loaded, savedCount);
         }
     }
     
@@ -183,19 +386,25 @@ bool SensorHistory::getEntry(int index, HistoryEntry& entry) const {
         return false;
     }
     
-    // Index 0 = oldest entry
-    int actualIdx = (head - count + index + HISTORY_ENTRIES) % HISTORY_ENTRIES;
-    entry = history[actualIdx];
+    readSlot(physicalIndex(index), entry);
     return true;
 }
 
+bool SensorHistory::getEntryBySequence(uint32_t seq, HistoryEntry& entry) const {
+    uint32_t age = totalAppended - seq;  // 1 = newest
+    if (seq >= totalAppended || age > (uint32_t)count) {
+        return false;
+    }
+    return getEntry(count - (int)age, entry);
+}
+
 bool SensorHistory::getLatestEntry(HistoryEntry& entry) const {
     if (!initialized || count == 0) {
         return false;
     }
     
     int latestIdx = (head - 1 + HISTORY_ENTRIES) % HISTORY_ENTRIES;
-    entry = history[latestIdx];
+    readSlot(latestIdx, entry);
     return true;
 }
 
@@ -206,29 +415,14 @@ bool SensorHistory::getAverage(int minutes, float& temp, float& hum,
     }
     
     int entriesToUse = min(minutes, count);
+    int start = physicalIndex(count - entriesToUse);
     
-    float tempSum = 0;
-    float humSum = 0;
-    int32_t co2Sum = 0;
-    int32_t vocSum = 0;
-    int32_t pm25Sum = 0;
-    
-    for (int i = count - entriesToUse; i < count; i++) {
-        HistoryEntry e;
-        if (getEntry(i, e)) {
-            tempSum += e.temp_x10 / 10.0f;
-            humSum += e.humidity;
-            co2Sum += e.co2;
-            vocSum += e.voc;
-            pm25Sum += e.pm25;
-        }
-    }
-    
-    temp = tempSum / entriesToUse;
-    hum = humSum / entriesToUse;
-    co2 = co2Sum / entriesToUse;
-    voc = vocSum / entriesToUse;
-    pm25 = pm25Sum / entriesToUse;
+    // One sequential pass per column
+    temp = (sumColumn(colTemp, start, entriesToUse) / 10.0f) / entriesToUse;
+    hum = (float)sumColumn(colHum, start, entriesToUse) / entriesToUse;
+    co2 = (int32_t)(sumColumn(colCO2, start, entriesToUse) / entriesToUse);
+    voc = (int32_t)(sumColumn(colVOC, start, entriesToUse) / entriesToUse);
+    pm25 = (int32_t)(sumColumn(colPM25, start, entriesToUse) / entriesToUse);
     
     return true;
 }
@@ -242,47 +436,218 @@ bool SensorHistory::getMinMax(int minutes,
     }
     
     int entriesToUse = min(minutes, count);
+    int start = physicalIndex(count - entriesToUse);
+    
+    int16_t tLo, tHi;
+    uint8_t hLo, hHi;
+    uint16_t cLo, cHi;
+    minMaxColumn(colTemp, start, entriesToUse, tLo, tHi);
+    minMaxColumn(colHum, start, entriesToUse, hLo, hHi);
+    minMaxColumn(colCO2, start, entriesToUse, cLo, cHi);
+    
+    tempMin = tLo / 10.0f;
+    tempMax = tHi / 10.0f;
+    humMin = hLo;
+    humMax = hHi;
+    co2Min = cLo;
+    co2Max = cHi;
     
-    // Initialize with first value
-    HistoryEntry first;
-    if (!getEntry(count - entriesToUse, first)) {
-        return false;
+    return true;
+}
+
+uint32_t SensorHistory::normalizedTimestamp(unsigned long nowMs) {
+    uint32_t uptime = nowMs / 1000;
+    time_t unixNow = time(nullptr);
+    
+    if (unixNow < (time_t)HISTORY_UNIX_MIN) {
+        // Clock not set yet: uptime seconds, rebased after the first sync
+        return uptime;
     }
     
-    tempMin = tempMax = first.temp_x10 / 10.0f;
-    humMin = humMax = first.humidity;
-    co2Min = co2Max = first.co2;
+    if (!timeSynced) {
+        // First valid time: move provisional entries onto the Unix base
+        uint32_t offset = (uint32_t)unixNow - uptime;
+        int firstPending = count - pendingUptime;
+        for (int i = firstPending; i < count; i++) {
+            colTimestamp[physicalIndex(i)] += offset;
+        }
+        timeSynced = true;
+        pendingUptime = 0;
+        
+        // Entries of an earlier boot newer than this boot: the clock was
+        // ahead back then. Move them before this boot, marked as a gap.
+        if (firstPending > 0 && firstPending < count) {
+            uint32_t older = colTimestamp[physicalIndex(firstPending - 1)];
+            uint32_t first = colTimestamp[physicalIndex(firstPending)];
+            if (first <= older) {
+                shiftEntriesBack(firstPending, older - first + HISTORY_GAP_SECONDS + 1);
+            }
+        }
+    }
     
-    // Go through the rest
-    for (int i = count - entriesToUse + 1; i < count; i++) {
-        HistoryEntry e;
-        if (getEntry(i, e)) {
-            float t = e.temp_x10 / 10.0f;
-            if (t < tempMin) tempMin = t;
-            if (t > tempMax) tempMax = t;
-            
-            if (e.humidity < humMin) humMin = e.humidity;
-            if (e.humidity > humMax) humMax = e.humidity;
-            
-            if (e.co2 < co2Min) co2Min = e.co2;
-            if (e.co2 > co2Max) co2Max = e.co2;
+    uint32_t ts = (uint32_t)unixNow;
+    if (count > 0) {
+        uint32_t last = colTimestamp[physicalIndex(count - 1)];
+        if (ts <= last) {
+            // Clock stepped backwards (NTP): the new time is right, so the
+            // stored entries move back and keep their real spacing. Without
+            // a millis() reference (entry of an earlier boot) it is a gap.
+            uint32_t elapsed = hasStampMs ? (nowMs - lastStampMs) / 1000 : HISTORY_GAP_SECONDS + 1;
+            if (elapsed == 0) elapsed = 1;
+            shiftEntriesBack(count, last + elapsed - ts);
+        }
+    }
+    lastStampMs = nowMs;
+    hasStampMs = true;
+    return ts;
+}
+
+void SensorHistory::shiftEntriesBack(int end, uint32_t shift) {
+    for (int i = 0; i < end; i++) {
+        colTimestamp[physicalIndex(i)] -= shift;
+    }
+    timeShift += shift;
+    Serial.printf("[HISTORY] Clock stepped back: %d entries moved by -%lu s\n",
+                  end, (unsigned long)shift);
+}
+
+uint32_t SensorHistory::getTimestamp(int index) const {
+    if (!initialized || index < 0 || index >= count) return 0;
+    return colTimestamp[physicalIndex(index)];
+}
+
+float SensorHistory::getValue(HistoryChannel channel, int index) const {
+    if (!initialized || index < 0 || index >= count) return 0.0f;
+    
+    int slot = physicalIndex(index);
+    switch (channel) {
+        case HIST_CH_TEMP: return colTemp[slot] / 10.0f;
+        case HIST_CH_HUM:  return colHum[slot];
+        case HIST_CH_CO2:  return colCO2[slot];
+        case HIST_CH_PM25: return colPM25[slot];
+        case HIST_CH_VOC:  return colVOC[slot];
+        default:           return 0.0f;
+    }
+}
+
+int SensorHistory::lowerBound(uint32_t t) const {
+    // First index with timestamp >= t (only the Unix-stamped part is sorted)
+    int lo = 0;
+    int hi = count - pendingUptime;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (colTimestamp[physicalIndex(mid)] < t) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
+    return lo;
+}
+
+HistoryRange SensorHistory::rangeQuery(uint32_t t0, uint32_t t1) const {
+    HistoryRange range;
+    range.history = this;
+    if (!initialized || t1 < t0) {
+        return range;
+    }
     
-    return true;
+    int from = lowerBound(t0);
+    int to = (t1 == UINT32_MAX) ? (count - pendingUptime) : lowerBound(t1 + 1);
+    range.first = from;
+    range.length = to - from;
+    return range;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// HISTORY RANGE
+// ═══════════════════════════════════════════════════════════════════════════
+
+uint32_t HistoryRange::timestamp(int i) const {
+    if (i < 0 || i >= length) return 0;
+    return history->getTimestamp(first + i);
+}
+
+float HistoryRange::value(HistoryChannel channel, int i) const {
+    if (i < 0 || i >= length) return 0.0f;
+    return history->getValue(channel, first + i);
+}
+
+bool HistoryRange::entry(int i, HistoryEntry& e) const {
+    if (i < 0 || i >= length) return false;
+    return history->getEntry(first + i, e);
+}
+
+bool HistoryRange::isGapBefore(int i) const {
+    if (i <= 0 || i >= length) return false;
+    return timestamp(i) - timestamp(i - 1) > HISTORY_GAP_SECONDS;
+}
+
+int HistoryRange::nextGap(int from) const {
+    for (int i = max(from + 1, 1); i < length; i++) {
+        if (isGapBefore(i)) return i;
+    }
+    return -1;
+}
+
+int HistoryRange::countGaps() const {
+    int gaps = 0;
+    for (int i = nextGap(0); i >= 0; i = nextGap(i)) {
+        gaps++;
+    }
+    return gaps;
+}
+
+int SensorHistory::copyChannel(HistoryChannel channel, int minutes, float* out, int maxOut) const {
+    if (!initialized || out == nullptr || count == 0 || minutes <= 0 || maxOut <= 0) {
+        return 0;
+    }
+    
+    int n = min(min(minutes, count), maxOut);
+    int start = physicalIndex(count - n);
+    
+    switch (channel) {
+        case HIST_CH_TEMP: copyColumn(colTemp, start, n, 0.1f, out); break;
+        case HIST_CH_HUM:  copyColumn(colHum, start, n, 1.0f, out);  break;
+        case HIST_CH_CO2:  copyColumn(colCO2, start, n, 1.0f, out);  break;
+        case HIST_CH_PM25: copyColumn(colPM25, start, n, 1.0f, out); break;
+        case HIST_CH_VOC:  copyColumn(colVOC, start, n, 1.0f, out);  break;
+        default: return 0;
+    }
+    return n;
 }
 
 void SensorHistory::clear() {
     if (!initialized) return;
     
+    // Withdraw a queued snapshot and let a running commit finish,
+    // otherwise the writer puts the old data back after the erase
+    for (;;) {
+        portENTER_CRITICAL(&snapshotLock);
+        pendingSnapshot = -1;
+        bool busy = (busySnapshot >= 0);
+        portEXIT_CRITICAL(&snapshotLock);
+        if (!busy) break;
+        vTaskDelay(1);
+    }
+    
     head = 0;
     count = 0;
-    memset(history, 0, sizeof(HistoryEntry) * HISTORY_ENTRIES);
-    
-    // Clear flash
+    totalAppended = 0;
+    timeSynced = false;
+    pendingUptime = 0;
+    timeShift = 0;
+    hasStampMs = false;
+    memset(storage, 0, STORAGE_SIZE);
+    
+    // Clear flash (stalls the cache like a commit)
+    if (commitLock != nullptr) commitLock();
+    xSemaphoreTake(prefsMutex, portMAX_DELAY);
     prefs.begin("sensorhist", false);
     prefs.clear();
     prefs.end();
+    xSemaphoreGive(prefsMutex);
+    if (commitUnlock != nullptr) commitUnlock();
     
     Serial.println("[HISTORY] All data cleared");
 }
@@ -298,8 +663,8 @@ void SensorHistory::printStatus() {
     Serial.println("╠═══════════════════════════════════════════════════════════╣");
     Serial.printf("║ Stored entries: %d / %d (%.1f%%)\n", 
                   count, HISTORY_ENTRIES, (count * 100.0f) / HISTORY_ENTRIES);
-    Serial.printf("║ Memory usage: %d KB\n",
-                  (count * sizeof(HistoryEntry)) / 1024);
+    Serial.printf("║ Memory usage: %d KB (%s)\n",
+                  (int)(STORAGE_SIZE / 1024), storageInPsram ? "PSRAM" : "internal RAM");
     
     if (count > 0) {
         HistoryEntry latest;
@@ -308,6 +673,18 @@ void SensorHistory::printStatus() {
                           latest.temp_x10 / 10.0f, latest.humidity, latest.co2);
         }
         
+        HistoryCommitStats stats = getCommitStats();
+        if (stats.commits > 0) {
+            Serial.printf("║ Flash commits: %lu, stall last/max/avg: %lu/%lu/%lu us\n",
+                          (unsigned long)stats.commits,
+                          (unsigned long)stats.lastStallUs,
+                          (unsigned long)stats.maxStallUs,
+                          (unsigned long)(stats.totalStallUs / stats.commits));
+            Serial.printf("║ Commit waited for render lock last/max: %lu/%lu ms\n",
+                          (unsigned long)stats.lastDeferMs,
+                          (unsigned long)stats.maxDeferMs);
+        }
+        
         // Average of last hour
         float avgT, avgH;
         int32_t avgCO2, avgVOC, avgPM;
@@ -339,7 +716,7 @@ void SensorHistory::printLastHours(int hours) {
         if (getEntry(i, e)) {
             // Format timestamp if available
             char timeStr[20] = "??:??";
-            if (e.timestamp > 1600000000) {  // Plausible Unix time
+            if (e.timestamp >= HISTORY_UNIX_MIN) {
                 time_t t = e.timestamp;
                 struct tm* tm = localtime(&t);
                 if (tm) {
@@ -358,3 +735,67 @@ void SensorHistory::printLastHours(int hours) {
     }
     Serial.println();
 }
+
+void SensorHistory::benchmarkLayout() {
+    if (!initialized) {
+        Serial.println("[HISTORY] Not initialized!");
+        return;
+    }
+    
+    // Previous layout for comparison, placed in the same memory type
+    uint32_t caps = (storageInPsram ? MALLOC_CAP_SPIRAM : MALLOC_CAP_INTERNAL) | MALLOC_CAP_8BIT;
+    HistoryEntry* aos = (HistoryEntry*)heap_caps_malloc(sizeof(HistoryEntry) * HISTORY_ENTRIES, caps);
+    // Export target only while benchmarking (no permanent .bss)
+    float* exportBuf = (float*)heap_caps_malloc(sizeof(float) * HISTORY_ENTRIES,
+                                                MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (aos == nullptr || exportBuf == nullptr) {
+        Serial.println("[HISTORY] Benchmark: not enough memory");
+        heap_caps_free(aos);
+        heap_caps_free(exportBuf);
+        return;
+    }
+    for (int i = 0; i < HISTORY_ENTRIES; i++) {
+        readSlot(i, aos[i]);
+    }
+    
+    const int ROUNDS = 100;
+    volatile int64_t sink = 0;
+    
+    // CO2-only scan over the full ring
+    unsigned long t0 = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        int64_t sum = 0;
+        for (int i = 0; i < HISTORY_ENTRIES; i++) sum += aos[i].co2;
+        sink += sum;
+    }
+    unsigned long aosScan = micros() - t0;
+    
+    t0 = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        sink += sumColumn(colCO2, 0, HISTORY_ENTRIES);
+    }
+    unsigned long soaScan = micros() - t0;
+    
+    // Single-channel export into a float buffer
+    t0 = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < HISTORY_ENTRIES; i++) exportBuf[i] = aos[i].co2;
+        sink += (int64_t)exportBuf[HISTORY_ENTRIES - 1];
+    }
+    unsigned long aosExport = micros() - t0;
+    
+    t0 = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        copyColumn(colCO2, 0, HISTORY_ENTRIES, 1.0f, exportBuf);
+        sink += (int64_t)exportBuf[HISTORY_ENTRIES - 1];
+    }
+    unsigned long soaExport = micros() - t0;
+    
+    heap_caps_free(aos);
+    heap_caps_free(exportBuf);
+    
+    Serial.printf("[HISTORY] Layout benchmark (%d entries, %d rounds, %s):\n",
+                  HISTORY_ENTRIES, ROUNDS, storageInPsram ? "PSRAM" : "internal RAM");
+    Serial.printf("          CO2 scan:   AoS %lu us, SoA %lu us\n", aosScan / ROUNDS, soaScan / ROUNDS);
+    Serial.printf("          CO2 export: AoS %lu us, SoA %lu us\n", aosExport / ROUNDS, soaExport / ROUNDS);
+}
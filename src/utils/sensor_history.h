@@ -6,7 +6,15 @@
  * Stores aggregated per-minute values for the last 24 hours.
  * Uses ESP32 Preferences (NVS) for persistent storage.
  *
- * Memory usage: ~35KB for 24h (1440 minutes * 24 bytes per entry)
+ * Flash commits run in a low-priority writer task: the main loop only
+ * copies the newest hour into one half of a double buffer, the task
+ * writes it to NVS while holding the render lock (see begin()).
+ *
+ * Storage is columnar (one contiguous array per channel plus a timestamp
+ * column), so a scan over a single channel streams only that channel's
+ * bytes through the cache. The block is placed in PSRAM when available.
+ *
+ * Memory usage: ~18KB for 24h (1440 minutes * 13 bytes per entry)
  */
 
 #ifndef SENSOR_HISTORY_H
@@ -14,6 +22,10 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
 #include "sensor_types.h"
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -23,13 +35,19 @@
 #define HISTORY_ENTRIES         1440    // 24h * 60 minutes
 #define HISTORY_SAVE_INTERVAL   60000   // Save every 60 seconds
 #define HISTORY_PERSIST_INTERVAL 300000 // Write to flash every 5 minutes
+#define HISTORY_FLASH_ENTRIES   60      // Entries persisted to flash (1h)
+#define HISTORY_WRITER_STACK    4096    // Writer task stack size
+#define HISTORY_WRITER_PRIORITY 1       // Just above idle
+#define HISTORY_WRITER_CORE     0       // Loop and rendering run on core 1
+#define HISTORY_UNIX_MIN        1600000000UL // Plausible Unix time (Sep 2020)
+#define HISTORY_GAP_SECONDS     150     // Larger spacing = device was off
 
 // ═══════════════════════════════════════════════════════════════════════════
 // DATA STRUCTURE FOR A HISTORY ENTRY
 // ═══════════════════════════════════════════════════════════════════════════
 
 struct HistoryEntry {
-    uint32_t timestamp;     // Unix timestamp or millis()
+    uint32_t timestamp;     // Unix time (uptime seconds until first time sync)
     int16_t temp_x10;       // Temperature * 10 (for 0.1° resolution)
     uint8_t humidity;       // Humidity (0-100%)
     uint16_t co2;           // CO2 in ppm
@@ -38,17 +56,121 @@ struct HistoryEntry {
     uint8_t reserved;       // Padding for alignment
 };
 
+/**
+ * Channels of the columnar history storage
+ */
+enum HistoryChannel : uint8_t {
+    HIST_CH_TEMP = 0,       // Temperature in °C
+    HIST_CH_HUM,            // Humidity in %
+    HIST_CH_CO2,            // CO2 in ppm
+    HIST_CH_PM25,           // PM2.5 in µg/m³
+    HIST_CH_VOC,            // VOC index
+    HIST_CH_COUNT
+};
+
+/**
+ * Copy of the data persisted by one flash commit
+ */
+struct HistorySnapshot {
+    int head;
+    int count;
+    int saved;
+    HistoryEntry entries[HISTORY_FLASH_ENTRIES];
+};
+
+/**
+ * Timing of flash commits (a commit stalls both cores while writing)
+ */
+struct HistoryCommitStats {
+    uint32_t commits;       // Completed commits
+    uint32_t lastStallUs;   // Duration of the last commit
+    uint32_t maxStallUs;    // Longest commit
+    uint64_t totalStallUs;  // Sum of all commits
+    uint32_t lastDeferMs;   // Wait for the render lock before the last commit
+    uint32_t maxDeferMs;    // Longest wait for the render lock
+};
+
+class SensorHistory;
+
+/**
+ * Called for every new per-minute entry, before it is written to the
+ * ring (the oldest entry is still readable at that point)
+ */
+typedef void (*HistoryAppendListener)(const HistoryEntry& entry, void* context);
+
+// ═══════════════════════════════════════════════════════════════════════════
+// RANGE VIEW (result of SensorHistory::rangeQuery)
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * Zero-copy view on the entries of a time range.
+ * Index 0 = oldest entry in the range. Values are read directly from the
+ * history columns, so the view is only valid until the next update().
+ */
+class HistoryRange {
+private:
+    friend class SensorHistory;
+    const SensorHistory* history = nullptr;
+    int first = 0;      // Index of the first entry in the history
+    int length = 0;
+
+public:
+    int size() const { return length; }
+    bool empty() const { return length == 0; }
+    
+    /**
+     * Index of the first range entry in SensorHistory (for getEntry)
+     */
+    int historyIndex() const { return first; }
+    
+    uint32_t timestamp(int i) const;
+    float value(HistoryChannel channel, int i) const;
+    bool entry(int i, HistoryEntry& e) const;
+    
+    /**
+     * True if the device was off between entry i-1 and i
+     */
+    bool isGapBefore(int i) const;
+    
+    /**
+     * Returns the next index > from that starts after a gap, or -1
+     */
+    int nextGap(int from) const;
+    
+    /**
+     * Number of gaps (device off) inside the range
+     */
+    int countGaps() const;
+};
+
 // ═══════════════════════════════════════════════════════════════════════════
 // SENSOR HISTORY CLASS
 // ═══════════════════════════════════════════════════════════════════════════
 
 class SensorHistory {
 private:
-    // Ring buffer for 24h history
-    HistoryEntry* history = nullptr;
+    // Ring buffer for 24h history (columnar, one allocation)
+    void* storage = nullptr;
+    bool storageInPsram = false;
+    uint32_t* colTimestamp = nullptr;
+    int16_t* colTemp = nullptr;
+    uint16_t* colCO2 = nullptr;
+    uint16_t* colPM25 = nullptr;
+    uint16_t* colVOC = nullptr;
+    uint8_t* colHum = nullptr;
     int head = 0;
     int count = 0;
     
+    // Time base: entries are stored with uptime seconds until the clock is
+    // set, then rebased to Unix time so the ring stays sorted
+    bool timeSynced = false;
+    int pendingUptime = 0;      // Newest entries still stamped with uptime
+    
+    // Clock steps backwards move the stored entries back (never +1 s stamps)
+    uint32_t timeShift = 0;             // Total seconds entries were moved back
+    unsigned long lastStampMs = 0;      // millis() of the last Unix stamp
+    bool hasStampMs = false;            // lastStampMs valid (stamped this boot)
+    
     // Accumulators for per-minute average
     float tempSum = 0;
     float humSum = 0;
@@ -63,17 +185,50 @@ private:
     
     // Preferences for flash storage
     Preferences prefs;
+    SemaphoreHandle_t prefsMutex = nullptr;
     bool initialized = false;
+    
+    // Background flash writer (double-buffered snapshots)
+    HistorySnapshot snapshots[2];
+    int pendingSnapshot = -1;   // Ready for the writer
+    int busySnapshot = -1;      // Being written by the writer
+    mutable portMUX_TYPE snapshotLock = portMUX_INITIALIZER_UNLOCKED;  // Also guards commitStats
+    TaskHandle_t writerTask = nullptr;
+    void (*commitLock)(void) = nullptr;
+    void (*commitUnlock)(void) = nullptr;
+    HistoryCommitStats commitStats = {};
+    
+    // Append notification (sequence = running number of an entry)
+    uint32_t totalAppended = 0;
+    HistoryAppendListener appendListener = nullptr;
+    void* appendContext = nullptr;
 
     // Internal storage helper
     void saveToFlash();
     void loadFromFlash();
+    void fillSnapshot(HistorySnapshot& snap) const;
+    void commitSnapshot(const HistorySnapshot& snap);
+    void runPendingCommit();
+    static void writerTaskEntry(void* arg);
+    bool allocateStorage();
+    void freeStorage();
+    void writeSlot(int slot, const HistoryEntry& entry);
+    void readSlot(int slot, HistoryEntry& entry) const;
+    int physicalIndex(int index) const;
+    uint32_t normalizedTimestamp(unsigned long nowMs);
+    void shiftEntriesBack(int end, uint32_t shift);
+    int lowerBound(uint32_t t) const;
 
 public:
     /**
-     * Initializes history and loads stored data
+     * Initializes history, loads stored data and starts the writer task
+     * @param lock Held for every flash commit and erase (e.g. lvgl_lock,
+     *             which the render task holds for a frame including its
+     *             flush), so flash access never overlaps a frame.
+     *             nullptr = commits start immediately.
+     * @param unlock Counterpart of lock
      */
-    bool begin();
+    bool begin(void (*lock)(void) = nullptr, void (*unlock)(void) = nullptr);
     
     /**
      * Cleans up and frees memory
@@ -91,6 +246,12 @@ public:
      */
     void update();
     
+    /**
+     * Returns timing statistics of the flash commits (consistent copy,
+     * the writer task updates them)
+     */
+    HistoryCommitStats getCommitStats() const;
+    
     /**
      * Returns the number of stored entries
      */
@@ -102,11 +263,60 @@ public:
      */
     bool getEntry(int index, HistoryEntry& entry) const;
     
+    /**
+     * Returns the entry with a sequence number (see getTotalAppended())
+     * @return false if the entry was overwritten or never existed
+     */
+    bool getEntryBySequence(uint32_t seq, HistoryEntry& entry) const;
+    
+    /**
+     * Returns the number of entries appended since begin() (incl. loaded
+     * entries); the newest entry has sequence getTotalAppended() - 1
+     */
+    uint32_t getTotalAppended() const { return totalAppended; }
+    
+    /**
+     * Registers a listener for new per-minute entries (one listener)
+     */
+    void setAppendListener(HistoryAppendListener listener, void* context) {
+        appendListener = listener;
+        appendContext = context;
+    }
+    
     /**
      * Returns the latest entry
      */
     bool getLatestEntry(HistoryEntry& entry) const;
     
+    /**
+     * Returns the timestamp of an entry (0 = oldest)
+     */
+    uint32_t getTimestamp(int index) const;
+    
+    /**
+     * Returns one channel of an entry (0 = oldest)
+     */
+    float getValue(HistoryChannel channel, int index) const;
+    
+    /**
+     * Returns all entries with t0 <= timestamp <= t1 (Unix time).
+     * Binary search over the ring, O(log n), no copying.
+     * Entries recorded before the first time sync are not included.
+     */
+    HistoryRange rangeQuery(uint32_t t0, uint32_t t1) const;
+    
+    /**
+     * True once history timestamps are on the Unix time base
+     */
+    bool isTimeSynced() const { return timeSynced; }
+    
+    /**
+     * Total seconds stored timestamps were moved back after clock steps.
+     * Consumers that keep timestamps of their own (charts) add it to new
+     * timestamps to stay on one continuous time base.
+     */
+    uint32_t getTimeShift() const { return timeShift; }
+    
     /**
      * Calculates average over the last N minutes
      */
@@ -122,7 +332,25 @@ public:
                    int32_t& co2Min, int32_t& co2Max) const;
     
     /**
-     * Clears all stored data
+     * Copies one channel of the last N minutes into a buffer (oldest first).
+     * Reads the channel column sequentially, other channels are not touched.
+     * @param channel Channel to export
+     * @param minutes Number of most recent entries
+     * @param out Target buffer
+     * @param maxOut Capacity of the target buffer
+     * @return Number of values written
+     */
+    int copyChannel(HistoryChannel channel, int minutes, float* out, int maxOut) const;
+    
+    /**
+     * Returns true if the history columns live in PSRAM
+     */
+    bool isInPsram() const { return storageInPsram; }
+    
+    /**
+     * Clears all stored data (RAM and flash). A queued snapshot is
+     * dropped and a running commit finished first, so nothing old is
+     * written back. Sequence numbers restart at 0.
      */
     void clear();
     
@@ -131,6 +359,12 @@ public:
      */
     void printStatus();
     void printLastHours(int hours);
+    
+    /**
+     * Benchmark: single-channel scan in columnar layout vs. the
+     * previous array-of-structs layout (prints results to Serial)
+     */
+    void benchmarkLayout();
 };
 
 // Global instance
@@ -0,0 +1,160 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - SENSOR QUANTILES (hourly P50/P95/P99)
+ * ═══════════════════════════════════════════════════════════════════════════
+ */
+
+#include "sensor_quantiles.h"
+#include "sensor_history.h"
+#include <time.h>
+
+// Global instance
+SensorQuantiles sensorQuantiles;
+
+static const char* const CHANNEL_NAMES[QCH_COUNT] = { "CO2", "PM2.5", "VOC" };
+
+bool SensorQuantiles::begin() {
+    // Allocate memory (only once!)
+    if (hours == nullptr) {
+        size_t size = QUANTILE_HOURS * sizeof(QuantileHour);
+        hours = (QuantileHour*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        hoursInPsram = (hours != nullptr);
+        if (hours == nullptr) {
+            hours = (QuantileHour*)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        }
+        if (hours == nullptr) {
+            Serial.println("[QUANTILE] ERROR: Could not allocate memory!");
+            return false;
+        }
+    }
+
+    current = 0;
+    filled = 1;
+    hourKey(currentKey, keyIsUnix);
+    hours[current].hourStart = currentKey * 3600UL;
+    for (int c = 0; c < QCH_COUNT; c++) {
+        hours[current].sketch[c].reset();
+    }
+
+    initialized = true;
+
+    Serial.println("[QUANTILE] Hourly quantile sketches initialized");
+    Serial.printf("          Memory: %d hours, %d KB in %s\n",
+                  QUANTILE_HOURS, (int)(QUANTILE_HOURS * sizeof(QuantileHour) / 1024),
+                  hoursInPsram ? "PSRAM" : "internal RAM");
+    return true;
+}
+
+void SensorQuantiles::hourKey(uint32_t& key, bool& isUnix) const {
+    time_t unixNow = time(nullptr);
+    isUnix = (unixNow >= (time_t)HISTORY_UNIX_MIN);
+    key = isUnix ? (uint32_t)(unixNow / 3600) : (uint32_t)(millis() / 3600000UL);
+}
+
+void SensorQuantiles::advanceTo(uint32_t key, bool isUnix) {
+    // Hours passed since the running hour (clock switch = 1 hour)
+    uint32_t steps = 1;
+    if (isUnix == keyIsUnix && key > currentKey) {
+        steps = key - currentKey;
+    }
+    if (steps > QUANTILE_HOURS) {
+        steps = QUANTILE_HOURS;
+    }
+
+    printHour(hours[current]);
+
+    // Skipped hours (device busy/clock jump) stay empty
+    for (uint32_t s = 0; s < steps; s++) {
+        current = (current + 1) % QUANTILE_HOURS;
+        if (filled < QUANTILE_HOURS) {
+            filled++;
+        }
+        hours[current].hourStart = (key - (steps - 1 - s)) * 3600UL;
+        for (int c = 0; c < QCH_COUNT; c++) {
+            hours[current].sketch[c].reset();
+        }
+    }
+
+    currentKey = key;
+    keyIsUnix = isUnix;
+}
+
+void SensorQuantiles::addSample(int32_t co2, int32_t pm25, int32_t voc) {
+    if (!initialized) return;
+
+    uint32_t key;
+    bool isUnix;
+    hourKey(key, isUnix);
+    if (key != currentKey || isUnix != keyIsUnix) {
+        advanceTo(key, isUnix);
+    }
+
+    QuantileHour& hour = hours[current];
+    hour.sketch[QCH_CO2].add((float)co2);
+    hour.sketch[QCH_PM25].add((float)pm25);
+    hour.sketch[QCH_VOC].add((float)voc);
+}
+
+const HourSketch* SensorQuantiles::getHour(QuantileChannel channel, int hoursAgo) const {
+    if (!initialized || channel >= QCH_COUNT || hoursAgo < 0 || hoursAgo >= filled) {
+        return nullptr;
+    }
+    int slot = (current - hoursAgo + QUANTILE_HOURS) % QUANTILE_HOURS;
+    return &hours[slot].sketch[channel];
+}
+
+float SensorQuantiles::getHourQuantile(QuantileChannel channel, int hoursAgo, float q) const {
+    const HourSketch* sketch = getHour(channel, hoursAgo);
+    return (sketch != nullptr) ? sketch->quantile(q) : 0;
+}
+
+void SensorQuantiles::mergeHours(QuantileChannel channel, int numHours, DaySketch& out) const {
+    out.reset();
+    for (int h = 0; h < numHours; h++) {
+        const HourSketch* sketch = getHour(channel, h);
+        if (sketch == nullptr) break;
+        out.merge(*sketch);
+    }
+}
+
+float SensorQuantiles::getDayQuantile(QuantileChannel channel, float q) const {
+    DaySketch day;
+    mergeHours(channel, QUANTILE_HOURS, day);
+    return day.quantile(q);
+}
+
+void SensorQuantiles::printHour(const QuantileHour& hour) const {
+    if (hour.sketch[QCH_CO2].getCount() == 0) return;
+
+    Serial.printf("[QUANTILE] Hour closed (%u samples):", (unsigned)hour.sketch[QCH_CO2].getCount());
+    for (int c = 0; c < QCH_COUNT; c++) {
+        const HourSketch& s = hour.sketch[c];
+        Serial.printf(" %s P50/P95/P99=%.0f/%.0f/%.0f", CHANNEL_NAMES[c],
+                      s.quantile(0.50f), s.quantile(0.95f), s.quantile(0.99f));
+    }
+    Serial.println();
+}
+
+void SensorQuantiles::printStatus() const {
+    if (!initialized) {
+        Serial.println("[QUANTILE] Not initialized!");
+        return;
+    }
+
+    Serial.println("\n╔═══════════════════════════════════════════════════════════╗");
+    Serial.println("║              SENSOR QUANTILES STATUS                      ║");
+    Serial.println("╠═══════════════════════════════════════════════════════════╣");
+    Serial.printf("║ Hours: %d / %d (%s clock)\n", filled, QUANTILE_HOURS,
+                  keyIsUnix ? "wall" : "uptime");
+    for (int c = 0; c < QCH_COUNT; c++) {
+        const HourSketch* hour = getHour((QuantileChannel)c, 0);
+        DaySketch day;
+        mergeHours((QuantileChannel)c, QUANTILE_HOURS, day);
+        Serial.printf("║ %-5s hour P50/P95/P99: %.0f / %.0f / %.0f\n", CHANNEL_NAMES[c],
+                      hour->quantile(0.50f), hour->quantile(0.95f), hour->quantile(0.99f));
+        Serial.printf("║ %-5s day  P50/P95/P99: %.0f / %.0f / %.0f (%lu samples)\n", CHANNEL_NAMES[c],
+                      day.quantile(0.50f), day.quantile(0.95f), day.quantile(0.99f),
+                      (unsigned long)day.getCount());
+    }
+    Serial.println("╚═══════════════════════════════════════════════════════════╝\n");
+}
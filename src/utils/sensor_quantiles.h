@@ -0,0 +1,112 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - SENSOR QUANTILES (hourly P50/P95/P99)
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Keeps one quantile sketch per hour for CO2, PM2.5 and VOC, fed with the
+ * raw 2-second samples. The last 24 hours are kept in a ring (current hour
+ * included); day percentiles are computed by merging the hourly sketches,
+ * no raw samples are stored.
+ *
+ * Hours are aligned to the wall clock once time is synced, before that to
+ * uptime. Hourly sketches live in RAM only (PSRAM when available).
+ */
+
+#ifndef SENSOR_QUANTILES_H
+#define SENSOR_QUANTILES_H
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include "quantile_sketch.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define QUANTILE_HOURS          24      // Hourly sketches kept (1 day)
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CHANNELS
+// ═══════════════════════════════════════════════════════════════════════════
+
+enum QuantileChannel : uint8_t {
+    QCH_CO2 = 0,            // CO2 in ppm
+    QCH_PM25,               // PM2.5 in µg/m³
+    QCH_VOC,                // VOC index
+    QCH_COUNT
+};
+
+/**
+ * Sketches of one hour (all channels)
+ */
+struct QuantileHour {
+    uint32_t hourStart;     // Unix time (or uptime seconds before sync)
+    HourSketch sketch[QCH_COUNT];
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SENSOR QUANTILES CLASS
+// ═══════════════════════════════════════════════════════════════════════════
+
+class SensorQuantiles {
+private:
+    QuantileHour* hours = nullptr;  // Ring of QUANTILE_HOURS entries
+    bool hoursInPsram = false;
+    int current = 0;                // Slot of the running hour
+    int filled = 0;                 // Slots in use (incl. current)
+    uint32_t currentKey = 0;        // Hour number of the running hour
+    bool keyIsUnix = false;         // currentKey counts Unix hours
+    bool initialized = false;
+
+    void hourKey(uint32_t& key, bool& isUnix) const;
+    void advanceTo(uint32_t key, bool isUnix);
+    void printHour(const QuantileHour& hour) const;
+
+public:
+    /**
+     * Initialization (allocates the hourly ring)
+     */
+    bool begin();
+
+    /**
+     * Adds one raw sample per channel (call every 2 seconds)
+     */
+    void addSample(int32_t co2, int32_t pm25, int32_t voc);
+
+    /**
+     * Returns the number of hours with data (max. QUANTILE_HOURS)
+     */
+    int getHourCount() const { return filled; }
+
+    /**
+     * Returns the sketch of an hour
+     * @param hoursAgo 0 = running hour, 1 = previous hour, ...
+     * @return nullptr if no such hour is stored
+     */
+    const HourSketch* getHour(QuantileChannel channel, int hoursAgo) const;
+
+    /**
+     * Returns the q-quantile of an hour (0 if no data)
+     */
+    float getHourQuantile(QuantileChannel channel, int hoursAgo, float q) const;
+
+    /**
+     * Merges the last `hours` hourly sketches (incl. running hour)
+     */
+    void mergeHours(QuantileChannel channel, int hours, DaySketch& out) const;
+
+    /**
+     * Returns the q-quantile of the last 24 hours (0 if no data)
+     */
+    float getDayQuantile(QuantileChannel channel, float q) const;
+
+    /**
+     * Debug output (P50/P95/P99 of the running hour and the day)
+     */
+    void printStatus() const;
+};
+
+// Global instance
+extern SensorQuantiles sensorQuantiles;
+
+#endif // SENSOR_QUANTILES_H
@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+"""
+InspectAir - font usage analysis and glyph subsetting
+
+Scans the firmware sources for the LVGL fonts that are actually referenced
+and for the text that can end up on screen (string literals outside of
+Serial logging), then shrinks every used font in src/display/fonts to the
+glyphs it can really display.
+
+Without --write only the report is printed:
+  - fonts that are compiled but never referenced (the linker drops them,
+    but they still cost compile time on every clean build) and the
+    build_src_filter lines that keep them out of the build
+  - per used font: glyphs and bytes now vs. after subsetting, measured on
+    the existing C arrays (no font converter needed for the estimate)
+  - total flash saving and the upload time it saves
+
+With --write the used fonts are regenerated with lv_font_conv
+(npx lv_font_conv) from their original "Opts:" line, with the range
+replaced by the subset. TTF files are looked up in --font-dir.
+
+Usage:
+    python tools/font_subset.py                      # report only
+    python tools/font_subset.py --write --font-dir ~/fonts
+
+A font never loses glyphs it did not have before, and digits plus the
+characters printf formats produce ("0-9 .,-+:%") are always kept.
+"""
+
+import argparse
+import glob
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+FONT_DIR = os.path.join(ROOT, "src", "display", "fonts")
+SOURCE_GLOBS = ["src/**/*.cpp", "src/**/*.h", "include/**/*.h"]
+
+# Characters produced by printf conversions / always useful for values
+ALWAYS_KEEP = set("0123456789 .,-+:%")
+
+# Glyph descriptor size in the C font format (lv_font_fmt_txt_glyph_dsc_t)
+GLYPH_DSC_BYTES = 8
+
+DEFAULT_UPLOAD_BAUD = 921600
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# FONT FILE PARSING
+# ═══════════════════════════════════════════════════════════════════════════
+
+class FontFile:
+    """Glyph table of an lv_font_conv C font (--no-compress output)."""
+
+    def __init__(self, path):
+        self.path = path
+        text = open(path, encoding="utf-8").read()
+
+        m = re.search(r"lv_font_t\s+(\w+)\s*=\s*\{", text)
+        if not m:
+            raise ValueError(f"{path}: no lv_font_t found")
+        self.symbol = m.group(1)
+
+        m = re.search(r"^\s*\*\s*Opts:\s*(.+)$", text, re.MULTILINE)
+        self.opts = m.group(1).strip() if m else None
+
+        m = re.search(r"glyph_bitmap\[\]\s*=\s*\{(.*?)\};", text, re.DOTALL)
+        self.bitmap_bytes = len(re.findall(r"0x[0-9a-fA-F]+", m.group(1))) if m else 0
+
+        self.bitmap_index = [int(v) for v in re.findall(r"\.bitmap_index\s*=\s*(\d+)", text)]
+
+        lists = {}
+        for name, body in re.findall(r"unicode_list_(\d+)\[\]\s*=\s*\{(.*?)\};", text, re.DOTALL):
+            lists["unicode_list_" + name] = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+        ofs_lists = {}
+        for name, body in re.findall(r"glyph_id_ofs_list_(\d+)\[\]\s*=\s*\{(.*?)\};", text, re.DOTALL):
+            ofs_lists["glyph_id_ofs_list_" + name] = [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", body)]
+
+        # codepoint -> glyph id
+        self.glyphs = {}
+        for m in re.finditer(r"\.range_start\s*=\s*(\d+),\s*\.range_length\s*=\s*(\d+),\s*"
+                             r"\.glyph_id_start\s*=\s*(\d+),\s*\.unicode_list\s*=\s*(\w+),\s*"
+                             r"\.glyph_id_ofs_list\s*=\s*(\w+),\s*\.list_length\s*=\s*\d+,\s*"
+                             r"\.type\s*=\s*LV_FONT_FMT_TXT_CMAP_(\w+)", text):
+            start, length, gid_start = int(m.group(1)), int(m.group(2)), int(m.group(3))
+            cmap_type = m.group(6)
+            if cmap_type.startswith("FORMAT0"):
+                ofs = ofs_lists.get(m.group(5))
+                for i in range(length):
+                    self.glyphs[start + i] = gid_start + (ofs[i] if ofs else i)
+            else:
+                ofs = ofs_lists.get(m.group(5))
+                for i, delta in enumerate(lists.get(m.group(4), [])):
+                    self.glyphs[start + delta] = gid_start + (ofs[i] if ofs else i)
+
+    def glyph_bytes(self, gid):
+        """Bitmap + descriptor bytes of one glyph."""
+        if gid >= len(self.bitmap_index):
+            return GLYPH_DSC_BYTES
+        end = self.bitmap_index[gid + 1] if gid + 1 < len(self.bitmap_index) else self.bitmap_bytes
+        return end - self.bitmap_index[gid] + GLYPH_DSC_BYTES
+
+    def size_of(self, codepoints):
+        return sum(self.glyph_bytes(self.glyphs[cp]) for cp in codepoints if cp in self.glyphs)
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# SOURCE SCANNING
+# ═══════════════════════════════════════════════════════════════════════════
+
+def source_files():
+    files = []
+    for pattern in SOURCE_GLOBS:
+        files += glob.glob(os.path.join(ROOT, pattern), recursive=True)
+    return sorted(f for f in set(files) if not f.startswith(FONT_DIR + os.sep))
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", " ", text, flags=re.DOTALL)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def decode_c_string(body):
+    """C string literal body -> str (UTF-8, \\x escapes, printf formats removed)."""
+    out = bytearray()
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c == "\\" and i + 1 < len(body):
+            n = body[i + 1]
+            if n == "x":
+                m = re.match(r"[0-9a-fA-F]{1,2}", body[i + 2:])
+                out.append(int(m.group(0), 16))
+                i += 2 + len(m.group(0))
+                continue
+            out += {"n": b"\n", "t": b"\t", "0": b""}.get(n, n.encode("utf-8"))
+            i += 2
+            continue
+        out += c.encode("utf-8")
+        i += 1
+    text = out.decode("utf-8", errors="ignore")
+    text = re.sub(r"%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l|z)?[diuxXfFeEgGcsp]", "", text)
+    return text.replace("%%", "%")
+
+
+def scan_sources():
+    """Returns (referenced font symbols, displayable characters)."""
+    refs = set()
+    chars = set()
+    for path in source_files():
+        text = strip_comments(open(path, encoding="utf-8", errors="ignore").read())
+
+        # FONT_xx macros resolve to &symbol; count symbols used outside declarations
+        macros = dict(re.findall(r"#define\s+(FONT_\w+)\s+&(\w+)", text))
+        used_macros = set(re.findall(r"\b(FONT_\w+)\b", re.sub(r"#define\s+FONT_\w+", "", text)))
+        refs |= {macros[m] for m in used_macros if m in macros}
+        body = re.sub(r"LV_FONT_DECLARE\(\w+\);", "", text)
+        body = re.sub(r"#define\s+FONT_\w+\s+&\w+", "", body)
+        refs |= set(re.findall(r"&(\w+)", body))
+
+        for line in text.splitlines():
+            if "Serial" in line or line.lstrip().startswith("#include"):
+                continue
+            for lit in re.findall(r'"((?:[^"\\]|\\.)*)"', line):
+                chars |= set(decode_c_string(lit))
+    return refs, chars
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# REGENERATION
+# ═══════════════════════════════════════════════════════════════════════════
+
+def format_range(codepoints):
+    """[48, 49, 50, 58] -> "48-50,58" (lv_font_conv --range syntax)."""
+    parts = []
+    cps = sorted(codepoints)
+    i = 0
+    while i < len(cps):
+        j = i
+        while j + 1 < len(cps) and cps[j + 1] == cps[j] + 1:
+            j += 1
+        parts.append(str(cps[i]) if i == j else f"{cps[i]}-{cps[j]}")
+        i = j + 1
+    return ",".join(parts)
+
+
+def find_ttf(name, font_dirs):
+    for d in font_dirs:
+        hits = glob.glob(os.path.join(d, "**", name), recursive=True)
+        if hits:
+            return hits[0]
+    return None
+
+
+def regenerate(font, codepoints, font_dirs):
+    args = shlex.split(font.opts)
+    ttf = None
+    out = []
+    i = 0
+    while i < len(args):
+        a = args[i]
+        if a in ("--font", "--range", "-o") and i + 1 < len(args):
+            if a == "--font":
+                ttf = find_ttf(args[i + 1], font_dirs)
+                if not ttf:
+                    print(f"  {font.symbol}: {args[i + 1]} not found, skipped", file=sys.stderr)
+                    return False
+            i += 2
+            continue
+        out.append(a)
+        i += 1
+
+    cmd = ["npx", "--yes", "lv_font_conv", *out, "--font", ttf,
+           "--range", format_range(codepoints), "-o", font.path]
+    if subprocess.run(cmd).returncode != 0:
+        print(f"  {font.symbol}: lv_font_conv failed", file=sys.stderr)
+        return False
+    return True
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# MAIN
+# ═══════════════════════════════════════════════════════════════════════════
+
+def main():
+    parser = argparse.ArgumentParser(description="Report and subset the LVGL fonts used by the UI")
+    parser.add_argument("--write", action="store_true", help="Regenerate used fonts with lv_font_conv")
+    parser.add_argument("--font-dir", action="append", default=[FONT_DIR],
+                        help="Directory searched for TTF files (repeatable)")
+    parser.add_argument("--upload-baud", type=int, default=DEFAULT_UPLOAD_BAUD,
+                        help="Upload speed for the flash time estimate")
+    args = parser.parse_args()
+
+    fonts = []
+    for path in sorted(glob.glob(os.path.join(FONT_DIR, "*.c"))):
+        try:
+            fonts.append(FontFile(path))
+        except ValueError:
+            pass    # Images, emojis
+
+    refs, chars = scan_sources()
+    wanted = {ord(c) for c in chars | ALWAYS_KEEP if ord(c) >= 32}
+
+    unused = [f for f in fonts if f.symbol not in refs]
+    used = [f for f in fonts if f.symbol in refs]
+
+    print(f"Displayable characters ({len(wanted)}): {''.join(sorted(chr(c) for c in wanted))}")
+    print()
+    print("Compiled but never referenced (dropped by the linker, only cost build time):")
+    for f in unused:
+        print(f"  {os.path.basename(f.path):<28} {f.size_of(f.glyphs):>8} bytes")
+    print("Excluded from the build in platformio.ini ([fonts] src_filter):")
+    for f in unused:
+        print(f"  -<display/fonts/{os.path.basename(f.path)}>")
+    print()
+
+    print(f"{'used font':<20} {'glyphs':>11} {'bytes now':>10} {'subset':>10} {'saved':>8}")
+    total_now = total_subset = 0
+    plans = []
+    for f in used:
+        keep = sorted(cp for cp in f.glyphs if cp in wanted)
+        now = f.size_of(f.glyphs)
+        subset = f.size_of(keep)
+        total_now += now
+        total_subset += subset
+        plans.append((f, keep))
+        print(f"{f.symbol:<20} {len(f.glyphs):>4} -> {len(keep):<4} {now:>10} {subset:>10} {now - subset:>8}")
+
+    saved = total_now - total_subset
+    upload_s = saved * 10 / args.upload_baud    # 8N1 framing, before esptool compression
+    print(f"{'total':<20} {'':>11} {total_now:>10} {total_subset:>10} {saved:>8}")
+    print()
+    print(f"Flash saving: {saved / 1024:.1f} KB glyph data "
+          f"(~{upload_s:.2f} s less upload at {args.upload_baud} baud)")
+
+    if args.write:
+        print()
+        ok = 0
+        for f, keep in plans:
+            if len(keep) == len(f.glyphs) or not f.opts:
+                continue
+            print(f"Regenerating {os.path.basename(f.path)} ({len(keep)} glyphs)")
+            ok += regenerate(f, keep, args.font_dir)
+        print(f"{ok} font(s) regenerated")
+
+
+if __name__ == "__main__":
+    main()
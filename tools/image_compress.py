@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""
+InspectAir - image asset compressor
+
+Converts LVGL 9 C image arrays (as exported by the LVGL image converter)
+into LZ4-compressed assets that are decoded into PSRAM at runtime
+(see src/display/ui_assets.h).
+
+Usage:
+    python tools/image_compress.py assets/images/img_tree_green.c [...] \
+        -o src/display/fonts
+
+For every input <name>.c an output <name>.c is written which defines
+`const ui_packed_image_t <name>_packed`. A size summary is printed.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+MIN_MATCH = 4
+MAX_OFFSET = 65535
+HASH_BITS = 16
+LAST_LITERALS = 5       # LZ4 block rule: last 5 bytes are literals
+MFLIMIT = 12            # No match may start in the last 12 bytes
+
+
+def parse_lvgl_image(path):
+    """Returns (symbol, cf, w, h, data) of an LVGL C image file."""
+    text = open(path, encoding="utf-8").read()
+
+    m = re.search(r"const\s+lv_image_dsc_t\s+(\w+)\s*=", text)
+    if not m:
+        raise ValueError(f"{path}: no lv_image_dsc_t found")
+    symbol = m.group(1)
+    dsc = text[m.end():]
+
+    cf = re.search(r"\.cf\s*=\s*(LV_COLOR_FORMAT_\w+)", dsc).group(1)
+    w = int(re.search(r"\.w\s*=\s*(\d+)", dsc).group(1))
+    h = int(re.search(r"\.h\s*=\s*(\d+)", dsc).group(1))
+
+    start = text.index("[] = {")
+    end = text.index("};", start)
+    data = bytes(int(x, 16) for x in re.findall(r"0x([0-9a-fA-F]{2})", text[start:end]))
+    return symbol, cf, w, h, data
+
+
+def _write_length(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def lz4_compress(src):
+    """Greedy LZ4 block compressor (no frame header)."""
+    n = len(src)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    limit = n - MFLIMIT
+
+    while i < limit:
+        key = src[i:i + MIN_MATCH]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > MAX_OFFSET:
+            i += 1
+            continue
+
+        # Extend the match
+        length = MIN_MATCH
+        max_len = n - LAST_LITERALS - i
+        while length < max_len and src[ref + length] == src[i + length]:
+            length += 1
+
+        literals = i - anchor
+        ml = length - MIN_MATCH
+        out.append((min(literals, 15) << 4) | min(ml, 15))
+        if literals >= 15:
+            _write_length(out, literals - 15)
+        out += src[anchor:i]
+        offset = i - ref
+        out.append(offset & 0xFF)
+        out.append(offset >> 8)
+        if ml >= 15:
+            _write_length(out, ml - 15)
+
+        i += length
+        anchor = i
+
+    # Last sequence: literals only
+    literals = n - anchor
+    out.append(min(literals, 15) << 4)
+    if literals >= 15:
+        _write_length(out, literals - 15)
+    out += src[anchor:]
+    return bytes(out)
+
+
+def lz4_decompress(src, size):
+    """Reference decoder (used to verify every asset)."""
+    out = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        literals = token >> 4
+        if literals == 15:
+            while True:
+                b = src[i]
+                i += 1
+                literals += b
+                if b != 255:
+                    break
+        out += src[i:i + literals]
+        i += literals
+        if i >= len(src):
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        ml = token & 0x0F
+        if ml == 15:
+            while True:
+                b = src[i]
+                i += 1
+                ml += b
+                if b != 255:
+                    break
+        ml += MIN_MATCH
+        start = len(out) - offset
+        for k in range(ml):
+            out.append(out[start + k])
+    if len(out) != size:
+        raise ValueError("decoded size mismatch")
+    return bytes(out)
+
+
+def stride_of(cf, w):
+    # RGB565A8: stride of the RGB565 plane (alpha plane follows with stride w)
+    bpp = {"LV_COLOR_FORMAT_RGB565": 2, "LV_COLOR_FORMAT_RGB565A8": 2,
+           "LV_COLOR_FORMAT_ARGB8888": 4, "LV_COLOR_FORMAT_RGB888": 3}
+    if cf not in bpp:
+        raise ValueError(f"unsupported color format {cf}")
+    return w * bpp[cf]
+
+
+def emit_c(symbol, cf, w, h, raw, packed, source_name):
+    lines = []
+    lines.append("/**")
+    lines.append(f" * {symbol} - LZ4-compressed image asset")
+    lines.append(f" * Generated by tools/image_compress.py from {source_name}, do not edit.")
+    lines.append(f" * {w}x{h} {cf}, {len(raw)} -> {len(packed)} bytes")
+    lines.append(" */")
+    lines.append("")
+    lines.append('#include "ui_assets.h"')
+    lines.append("")
+    lines.append(f"static const uint8_t {symbol}_lz4[] = {{")
+    for k in range(0, len(packed), 24):
+        chunk = packed[k:k + 24]
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in chunk) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const ui_packed_image_t {symbol}_packed = {{")
+    lines.append(f"  .cf = {cf},")
+    lines.append(f"  .w = {w},")
+    lines.append(f"  .h = {h},")
+    lines.append(f"  .stride = {stride_of(cf, w)},")
+    lines.append(f"  .raw_size = {len(raw)},")
+    lines.append(f"  .packed_size = sizeof({symbol}_lz4),")
+    lines.append(f"  .data = {symbol}_lz4,")
+    lines.append(f'  .name = "{symbol}",')
+    lines.append("};")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compress LVGL C image arrays with LZ4")
+    parser.add_argument("inputs", nargs="+", help="LVGL C image files")
+    parser.add_argument("-o", "--out-dir", required=True, help="Output directory")
+    args = parser.parse_args()
+
+    total_raw = 0
+    total_packed = 0
+    print(f"{'asset':<28} {'raw':>9} {'packed':>9} {'ratio':>6}")
+    for path in args.inputs:
+        symbol, cf, w, h, raw = parse_lvgl_image(path)
+        packed = lz4_compress(raw)
+        if lz4_decompress(packed, len(raw)) != raw:
+            print(f"{path}: round trip failed", file=sys.stderr)
+            return 1
+
+        out_path = os.path.join(args.out_dir, symbol + ".c")
+        with open(out_path, "w", encoding="utf-8") as f:
+            f.write(emit_c(symbol, cf, w, h, raw, packed, os.path.basename(path)))
+
+        total_raw += len(raw)
+        total_packed += len(packed)
+        print(f"{symbol:<28} {len(raw):>9} {len(packed):>9} {len(raw) / len(packed):>5.1f}x")
+
+    print(f"{'total':<28} {total_raw:>9} {total_packed:>9} {total_raw / max(total_packed, 1):>5.1f}x")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
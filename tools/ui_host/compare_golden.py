@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+InspectAir - golden image comparison for the host UI harness
+
+Compares the screenshots written by the native_ui build against the
+golden images (see tools/ui_host/ui_host_main.cpp).
+
+Usage:
+    python tools/ui_host/compare_golden.py GOLDEN_DIR OUT_DIR [--tolerance N] [--max-pixels N]
+    python tools/ui_host/compare_golden.py GOLDEN_DIR OUT_DIR --update
+
+A pixel differs if any channel differs by more than --tolerance (default 0).
+Exit code 1 if an image is missing or more than --max-pixels differ.
+--update copies the current screenshots over the golden images instead.
+"""
+
+import argparse
+import os
+import shutil
+import struct
+import sys
+import zlib
+
+
+def read_png(path):
+    """Returns (w, h, rows) of an 8-bit RGB/RGBA PNG, rows as RGB bytes."""
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG")
+
+    pos = 8
+    idat = b""
+    w = h = color = None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if ctype == b"IHDR":
+            w, h, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or color not in (2, 6) or interlace:
+                raise ValueError(f"{path}: only 8-bit RGB/RGBA, non-interlaced")
+        elif ctype == b"IDAT":
+            idat += body
+        pos += 12 + length
+
+    bpp = 3 if color == 2 else 4
+    stride = w * bpp
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    for y in range(h):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xff
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xff
+        prev = line
+        if bpp == 4:
+            line = bytearray(v for i, v in enumerate(line) if i % 4 != 3)
+        rows.append(bytes(line))
+    return w, h, rows
+
+
+def count_diff(golden, current, tolerance):
+    gw, gh, grows = golden
+    cw, ch, crows = current
+    if (gw, gh) != (cw, ch):
+        return None
+    diff = 0
+    for grow, crow in zip(grows, crows):
+        if grow == crow:
+            continue
+        for x in range(0, len(grow), 3):
+            if any(abs(grow[x + k] - crow[x + k]) > tolerance for k in range(3)):
+                diff += 1
+    return diff
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    ap.add_argument("golden_dir")
+    ap.add_argument("out_dir")
+    ap.add_argument("--tolerance", type=int, default=0)
+    ap.add_argument("--max-pixels", type=int, default=0)
+    ap.add_argument("--update", action="store_true")
+    args = ap.parse_args()
+
+    shots = sorted(f for f in os.listdir(args.out_dir) if f.endswith(".png"))
+    if not shots:
+        print(f"No screenshots in {args.out_dir}")
+        return 1
+
+    if args.update:
+        os.makedirs(args.golden_dir, exist_ok=True)
+        for name in shots:
+            shutil.copyfile(os.path.join(args.out_dir, name), os.path.join(args.golden_dir, name))
+        print(f"{len(shots)} golden images updated")
+        return 0
+
+    failed = 0
+    for name in shots:
+        golden_path = os.path.join(args.golden_dir, name)
+        if not os.path.exists(golden_path):
+            print(f"  NEW   {name} (no golden image)")
+            failed += 1
+            continue
+        diff = count_diff(read_png(golden_path), read_png(os.path.join(args.out_dir, name)),
+                          args.tolerance)
+        if diff is None:
+            print(f"  FAIL  {name}: size differs")
+            failed += 1
+        elif diff > args.max_pixels:
+            print(f"  FAIL  {name}: {diff} pixels differ")
+            failed += 1
+        else:
+            print(f"  ok    {name}" + (f" ({diff} pixels within limit)" if diff else ""))
+
+    print(f"{len(shots) - failed}/{len(shots)} screenshots match")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,108 @@
+/**
+ * InspectAir - host (Linux) display driver for the UI harness
+ */
+
+#include "host_driver.h"
+#include <Arduino.h>
+#include <time.h>
+
+HostSerial Serial;
+
+// Same band height as the device with internal DMA buffers
+#define HOST_BAND_LINES 64
+
+static lv_display_t* display = nullptr;
+static uint16_t framebuffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+static uint8_t band_buf1[SCREEN_WIDTH * HOST_BAND_LINES * 2];
+static uint8_t band_buf2[SCREEN_WIDTH * HOST_BAND_LINES * 2];
+static uint32_t virtual_ms = 0;
+static uint32_t flushed_px = 0;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ARDUINO TIME FUNCTIONS (real time, used for measurements)
+// ═══════════════════════════════════════════════════════════════════════════
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+extern "C" uint32_t millis(void) {
+    return (uint32_t)(now_us() / 1000);
+}
+
+extern "C" uint32_t micros(void) {
+    return (uint32_t)now_us();
+}
+
+extern "C" void delay(uint32_t ms) {
+    (void)ms;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DISPLAY
+// ═══════════════════════════════════════════════════════════════════════════
+
+static void host_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    const uint16_t* src = (const uint16_t*)px_map;
+    int32_t w = area->x2 - area->x1 + 1;
+    
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&framebuffer[y * SCREEN_WIDTH + area->x1], src, w * 2);
+        src += w;
+    }
+    flushed_px += w * (area->y2 - area->y1 + 1);
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t host_tick_cb(void) {
+    return virtual_ms;
+}
+
+void lvgl_init(void) {
+    lv_init();
+    lv_tick_set_cb(host_tick_cb);
+    
+    display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
+    lv_display_set_flush_cb(display, host_flush_cb);
+    lv_display_set_buffers(display, band_buf1, band_buf2, sizeof(band_buf1),
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+}
+
+void lvgl_loop(void) {
+    lv_timer_handler();
+}
+
+bool lvgl_start_task(void (*hook)(void)) {
+    (void)hook;
+    return false;   // The harness drives LVGL itself
+}
+
+void lvgl_wake(void) {
+    // No render task on the host
+}
+
+void lvgl_finish_frame(void) {
+    // Flushes complete synchronously
+}
+
+void lvgl_lock(void) {
+}
+
+void lvgl_unlock(void) {
+}
+
+const uint16_t* host_framebuffer(void) {
+    return framebuffer;
+}
+
+void host_advance_ms(uint32_t ms) {
+    virtual_ms += ms;
+}
+
+uint32_t host_take_flushed_pixels(void) {
+    uint32_t px = flushed_px;
+    flushed_px = 0;
+    return px;
+}
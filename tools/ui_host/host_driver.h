@@ -0,0 +1,29 @@
+/**
+ * InspectAir - host (Linux) display driver for the UI harness
+ *
+ * Implements the lvgl_driver.h API on a memory framebuffer instead of
+ * LovyanGFX/ST7796S. The LVGL tick is a virtual clock advanced by the
+ * harness, so animations and screenshots are reproducible.
+ */
+
+#ifndef UI_HOST_DRIVER_H
+#define UI_HOST_DRIVER_H
+
+#include "lvgl_driver.h"
+
+/**
+ * RGB565 framebuffer (SCREEN_WIDTH x SCREEN_HEIGHT, native byte order)
+ */
+const uint16_t* host_framebuffer(void);
+
+/**
+ * Advances the virtual LVGL tick
+ */
+void host_advance_ms(uint32_t ms);
+
+/**
+ * Pixels flushed since the last call (0 = nothing was redrawn)
+ */
+uint32_t host_take_flushed_pixels(void);
+
+#endif // UI_HOST_DRIVER_H
@@ -0,0 +1,112 @@
+/**
+ * InspectAir - minimal PNG writer for the UI harness
+ */
+
+#include "png_writer.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+static uint32_t crc_table[256];
+
+static void crc_init(void) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc = crc_table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void put_u32(std::vector<uint8_t>& out, uint32_t v) {
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+static void write_chunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    put_u32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    uint32_t crc = crc32(chunk.data() + 4, chunk.size() - 4);
+    put_u32(chunk, crc);
+    fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+bool png_write_rgb565(const char* path, const uint16_t* pixels, int w, int h) {
+    if (crc_table[1] == 0) crc_init();
+
+    // Raw scanlines: filter byte 0 + RGB888
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)h * (w * 3 + 1));
+    for (int y = 0; y < h; y++) {
+        raw.push_back(0);
+        for (int x = 0; x < w; x++) {
+            uint16_t c = pixels[y * w + x];
+            uint8_t r = (c >> 11) & 0x1f;
+            uint8_t g = (c >> 5) & 0x3f;
+            uint8_t b = c & 0x1f;
+            raw.push_back((r << 3) | (r >> 2));
+            raw.push_back((g << 2) | (g >> 4));
+            raw.push_back((b << 3) | (b >> 2));
+        }
+    }
+
+    // zlib stream with stored (uncompressed) deflate blocks
+    std::vector<uint8_t> z;
+    z.push_back(0x78);
+    z.push_back(0x01);
+    size_t pos = 0;
+    do {
+        size_t len = raw.size() - pos;
+        if (len > 65535) len = 65535;
+        bool last = (pos + len == raw.size());
+        z.push_back(last ? 1 : 0);
+        z.push_back(len & 0xff);
+        z.push_back(len >> 8);
+        z.push_back(~len & 0xff);
+        z.push_back((~len >> 8) & 0xff);
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + len);
+        pos += len;
+    } while (pos < raw.size());
+
+    uint32_t a = 1, b = 0;
+    for (uint8_t v : raw) {
+        a = (a + v) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_u32(z, (b << 16) | a);
+
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    fwrite(signature, 1, sizeof(signature), f);
+
+    std::vector<uint8_t> ihdr;
+    put_u32(ihdr, w);
+    put_u32(ihdr, h);
+    ihdr.push_back(8);      // Bit depth
+    ihdr.push_back(2);      // Color type RGB
+    ihdr.push_back(0);      // Compression
+    ihdr.push_back(0);      // Filter
+    ihdr.push_back(0);      // No interlace
+    write_chunk(f, "IHDR", ihdr);
+    write_chunk(f, "IDAT", z);
+    write_chunk(f, "IEND", std::vector<uint8_t>());
+
+    bool ok = !ferror(f);
+    fclose(f);
+    return ok;
+}
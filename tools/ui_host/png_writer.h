@@ -0,0 +1,17 @@
+/**
+ * InspectAir - minimal PNG writer for the UI harness
+ * 8-bit RGB, uncompressed deflate blocks (no zlib dependency).
+ */
+
+#ifndef UI_HOST_PNG_WRITER_H
+#define UI_HOST_PNG_WRITER_H
+
+#include <stdint.h>
+
+/**
+ * Writes an RGB565 image as PNG
+ * @return false if the file could not be written
+ */
+bool png_write_rgb565(const char* path, const uint16_t* pixels, int w, int h);
+
+#endif // UI_HOST_PNG_WRITER_H
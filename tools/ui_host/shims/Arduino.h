@@ -0,0 +1,52 @@
+/**
+ * InspectAir - host build shim for <Arduino.h>
+ *
+ * Just enough of the Arduino core for ui_manager/ui_assets (and lv_conf.h,
+ * which is also included from LVGL's C sources). Serial goes to stderr so
+ * stdout stays free for the benchmark report.
+ */
+
+#ifndef UI_HOST_ARDUINO_H
+#define UI_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(uint32_t ms);
+
+#ifdef __cplusplus
+} /* extern "C" */
+
+#include <stdarg.h>
+
+class HostSerial {
+public:
+    void begin(unsigned long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() { fflush(stderr); }
+
+    int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, fmt);
+        int n = vfprintf(stderr, fmt, args);
+        va_end(args);
+        return n;
+    }
+    void print(const char* s) { fputs(s, stderr); }
+    void println(const char* s = "") { fprintf(stderr, "%s\n", s); }
+};
+
+extern HostSerial Serial;
+#endif
+
+#endif // UI_HOST_ARDUINO_H
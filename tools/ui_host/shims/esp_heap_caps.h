@@ -0,0 +1,38 @@
+/**
+ * InspectAir - host build shim for <esp_heap_caps.h>
+ * All capabilities map to the normal heap.
+ */
+
+#ifndef UI_HOST_ESP_HEAP_CAPS_H
+#define UI_HOST_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+#include <stddef.h>
+
+#define MALLOC_CAP_8BIT      (1 << 2)
+#define MALLOC_CAP_DMA       (1 << 3)
+#define MALLOC_CAP_SPIRAM    (1 << 10)
+#define MALLOC_CAP_INTERNAL  (1 << 11)
+
+static inline void* heap_caps_malloc(size_t size, unsigned caps) {
+    (void)caps;
+    return malloc(size);
+}
+
+static inline void* heap_caps_aligned_alloc(size_t alignment, size_t size, unsigned caps) {
+    (void)caps;
+    if (alignment < sizeof(void*)) alignment = sizeof(void*);
+    void* p = NULL;
+    return posix_memalign(&p, alignment, size) == 0 ? p : NULL;
+}
+
+static inline void heap_caps_free(void* p) {
+    free(p);
+}
+
+static inline size_t heap_caps_get_free_size(unsigned caps) {
+    (void)caps;
+    return 8u * 1024 * 1024;
+}
+
+#endif // UI_HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,21 @@
+/**
+ * InspectAir - host build shim for <freertos/FreeRTOS.h>
+ * The host harness is single-threaded: only the types and constants the
+ * UI code uses.
+ */
+
+#ifndef UI_HOST_FREERTOS_H
+#define UI_HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE          1
+#define pdFALSE         0
+#define pdPASS          pdTRUE
+#define portMAX_DELAY   0xffffffffUL
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#endif // UI_HOST_FREERTOS_H
@@ -0,0 +1,50 @@
+/**
+ * InspectAir - host build shim for <freertos/queue.h>
+ * Fixed-size copy queue without blocking (single-threaded harness).
+ */
+
+#ifndef UI_HOST_FREERTOS_QUEUE_H
+#define UI_HOST_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    uint8_t* items;
+    uint32_t item_size;
+    uint32_t length;
+    uint32_t head;
+    uint32_t count;
+} HostQueue;
+
+typedef HostQueue* QueueHandle_t;
+
+static inline QueueHandle_t xQueueCreate(uint32_t length, uint32_t item_size) {
+    HostQueue* q = (HostQueue*)calloc(1, sizeof(HostQueue));
+    if (!q) return NULL;
+    q->items = (uint8_t*)malloc((size_t)length * item_size);
+    q->item_size = item_size;
+    q->length = length;
+    return q;
+}
+
+static inline BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t wait) {
+    (void)wait;
+    if (q->count == q->length) return pdFALSE;
+    uint32_t tail = (q->head + q->count) % q->length;
+    memcpy(q->items + (size_t)tail * q->item_size, item, q->item_size);
+    q->count++;
+    return pdTRUE;
+}
+
+static inline BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t wait) {
+    (void)wait;
+    if (q->count == 0) return pdFALSE;
+    memcpy(item, q->items + (size_t)q->head * q->item_size, q->item_size);
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+    return pdTRUE;
+}
+
+#endif // UI_HOST_FREERTOS_QUEUE_H
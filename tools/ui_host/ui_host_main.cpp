@@ -0,0 +1,160 @@
+/**
+ * ═══════════════════════════════════════════════════════════════════════════
+ * INSPECTAIR - HOST UI HARNESS (screenshots + render benchmark)
+ * ═══════════════════════════════════════════════════════════════════════════
+ *
+ * Runs the real ui_manager.cpp against LVGL on Linux (memory framebuffer,
+ * see host_driver.cpp). Every screen is driven through the same scripted
+ * sensor sequences; after each step a PNG screenshot is written and the
+ * render time per frame is reported.
+ *
+ *   pio run -e native_ui
+ *   .pio/build/native_ui/program [out_dir]          (default: ui_screenshots)
+ *   python tools/ui_host/compare_golden.py tools/ui_host/golden ui_screenshots
+ *
+ * Output: <out_dir>/<screen>_<step>.png and <out_dir>/report.csv, the same
+ * table is printed to stdout (log output of the UI goes to stderr).
+ *
+ * Times are host CPU times: useful to compare screens and catch
+ * regressions, not as absolute ESP32-S3 numbers.
+ */
+
+#include "host_driver.h"
+#include "png_writer.h"
+#include "ui_manager.h"
+#include <Arduino.h>
+#include <sys/stat.h>
+
+// Virtual time per LVGL cycle and cycles per step (animations settle)
+#define HOST_FRAME_MS       33
+#define HOST_STEP_FRAMES    60      // ~2 s virtual time
+#define HOST_FULL_REDRAWS   10
+
+// Scripted sensor sequence, same for every screen
+struct SensorStep {
+    const char* name;
+    float temp;
+    float hum;
+    int co2;
+    int pm25;
+    int pm10;
+    int voc;
+};
+
+static const SensorStep STEPS[] = {
+    { "good",     22.5f, 45.0f,  620,  4,  12,  90 },
+    { "moderate", 26.8f, 62.0f, 1150, 22,  38, 210 },
+    { "bad",      31.0f, 78.0f, 1850, 58,  95, 420 },
+    { "recover",  23.0f, 48.0f,  750,  9,  16, 120 },
+};
+static const int STEP_COUNT = sizeof(STEPS) / sizeof(STEPS[0]);
+
+static const char* SCREEN_FILE_NAMES[UI_SCREEN_COUNT] = {
+    "tree", "overview", "detail", "analog", "bubble", "history"
+};
+
+// Synthetic week of per-minute history for the chart screen
+#define HOST_HISTORY_END    1769868000UL    // Fr, 31. Jan 2026 14:00 UTC
+#define HOST_HISTORY_DAYS   7
+
+static void load_history(void) {
+    const uint32_t minutes = HOST_HISTORY_DAYS * 24 * 60;
+    for (uint32_t m = 0; m < minutes; m++) {
+        float day = (m % 1440) / 1440.0f;
+        float occupied = (day > 0.33f && day < 0.9f) ? 1.0f : 0.0f;
+        int co2 = 450 + (int)(occupied * (500 + 300 * sinf(m / 37.0f)));
+        int pm25 = 5 + (int)(4 * sinf(m / 211.0f)) + ((m % 1440) == 1100 ? 40 : 0);
+        float temp = 21.0f + 1.5f * sinf(day * 6.2832f) + occupied;
+        ui_loadHistoryPoint(HOST_HISTORY_END - (minutes - m) * 60, temp, co2, pm25);
+    }
+}
+
+/**
+ * Runs LVGL cycles like the render task does
+ * @return Frames that actually redrew something, render time in *render_us
+ */
+static uint32_t run_frames(int count, uint64_t* render_us) {
+    uint32_t frames = 0;
+    for (int i = 0; i < count; i++) {
+        host_advance_ms(HOST_FRAME_MS);
+        ui_processMessages();
+        
+        uint32_t t0 = micros();
+        lvgl_loop();
+        uint32_t dt = micros() - t0;
+        
+        if (host_take_flushed_pixels() > 0) {
+            frames++;
+            *render_us += dt;
+        }
+    }
+    return frames;
+}
+
+/**
+ * Average time of a forced full-screen redraw
+ */
+static uint32_t full_redraw_us(void) {
+    uint32_t t0 = micros();
+    for (int i = 0; i < HOST_FULL_REDRAWS; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+    host_take_flushed_pixels();
+    return (micros() - t0) / HOST_FULL_REDRAWS;
+}
+
+int main(int argc, char** argv) {
+    const char* out_dir = (argc > 1) ? argv[1] : "ui_screenshots";
+    mkdir(out_dir, 0755);
+    
+    char path[256];
+    snprintf(path, sizeof(path), "%s/report.csv", out_dir);
+    FILE* report = fopen(path, "w");
+    if (!report) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return 1;
+    }
+    
+    // Leaf paths use rand(): same sequence on every run
+    srand(1);
+    
+    lvgl_init();
+    ui_init();
+    load_history();
+    ui_updateTime(14, 32, 5);
+    ui_updateDate("Fr, 31. Jan 2026");
+    
+    const char* header = "screen,step,frames,avg_frame_us,full_redraw_us";
+    fprintf(report, "%s\n", header);
+    printf("%-9s %-9s %7s %13s %15s\n", "screen", "step", "frames", "avg_frame_us", "full_redraw_us");
+    
+    int failures = 0;
+    for (int s = 0; s < UI_SCREEN_COUNT; s++) {
+        ui_setScreen((UIScreen)s);
+        
+        for (int i = 0; i < STEP_COUNT; i++) {
+            const SensorStep& step = STEPS[i];
+            ui_updateSensorValues(step.temp, step.hum, step.co2, step.pm25, step.pm10, step.voc);
+            
+            uint64_t render_us = 0;
+            uint32_t frames = run_frames(HOST_STEP_FRAMES, &render_us);
+            uint32_t avg_us = frames ? (uint32_t)(render_us / frames) : 0;
+            uint32_t full_us = full_redraw_us();
+            
+            snprintf(path, sizeof(path), "%s/%s_%s.png", out_dir, SCREEN_FILE_NAMES[s], step.name);
+            if (!png_write_rgb565(path, host_framebuffer(), SCREEN_WIDTH, SCREEN_HEIGHT)) {
+                fprintf(stderr, "Cannot write %s\n", path);
+                failures++;
+            }
+            
+            fprintf(report, "%s,%s,%lu,%lu,%lu\n", SCREEN_FILE_NAMES[s], step.name,
+                    (unsigned long)frames, (unsigned long)avg_us, (unsigned long)full_us);
+            printf("%-9s %-9s %7lu %13lu %15lu\n", SCREEN_FILE_NAMES[s], step.name,
+                   (unsigned long)frames, (unsigned long)avg_us, (unsigned long)full_us);
+        }
+    }
+    
+    fclose(report);
+    return failures ? 1 : 0;
+}